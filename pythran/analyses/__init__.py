@@ -38,8 +38,10 @@ from .ordered_global_declarations import OrderedGlobalDeclarations
 from .parallel_maps import ParallelMaps
 from .potential_iterator import PotentialIterator
 from .pure_expressions import PureExpressions
+from .ragged_arguments import RaggedArguments
 from .range_values import RangeValues
 from .scope import Scope
+from .shared_operands import SharedOperands
 from .static_expressions import StaticExpressions, HasStaticExpression
 from .use_def_chain import DefUseChains, UseDefChains
 from .use_omp import UseOMP
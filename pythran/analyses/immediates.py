@@ -1,12 +1,20 @@
-""" Immediates gathers immediates. For now, only integers within shape are
+""" Immediates gathers immediates. For now, only integers within shape, and
+integers that set the rank of the result of a few numpy functions are
 considered as immediates """
 
 from pythran.analyses import Aliases
 from pythran.passmanager import NodeAnalysis
+from pythran.tables import MODULES
 from pythran.utils import pythran_builtin, isnum
 
 _make_shape = pythran_builtin('make_shape')
 
+# position of the argument setting the rank of the result
+_rank_arguments = {
+    MODULES['numpy']['einsum']: 0,
+    MODULES['numpy']['tensordot']: 2,
+}
+
 
 class Immediates(NodeAnalysis):
     def __init__(self):
@@ -21,5 +29,11 @@ class Immediates(NodeAnalysis):
                                and isinstance(a.value, int)
                                and a.value >= 0)
             return
+        for func_alias in func_aliases:
+            index = _rank_arguments.get(func_alias)
+            if index is not None and len(node.args) > index:
+                arg = node.args[index]
+                if isnum(arg) and isinstance(arg.value, int):
+                    self.result.add(arg)
 
         return self.generic_visit(node)
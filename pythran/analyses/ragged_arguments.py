@@ -0,0 +1,99 @@
+"""
+RaggedArguments finds the list of lists arguments that are only read.
+
+Such arguments can be converted to a ragged list of lists, that stores all
+its rows in a single buffer.
+"""
+
+from pythran.analyses.aliases import Aliases
+from pythran.analyses.ancestors import Ancestors
+from pythran.analyses.use_def_chain import DefUseChains
+from pythran.passmanager import ModuleAnalysis
+from pythran.tables import MODULES
+
+import gast as ast
+
+
+class RaggedArguments(ModuleAnalysis):
+
+    """
+    Gather, for each function, the index of the arguments that are never
+    rebound and whose uses, and the uses of their rows, are limited to
+    indexing, iterating, taking their length and turning them into an array.
+
+    The rows of a ragged list are sliced lists: anything else, such as
+    storing a row or passing it to another function, could combine their
+    type with a list type, so it makes the argument a regular list.
+    """
+
+    # functions that only read the rows they are given
+    ROW_READERS = ('len', 'sum', 'min', 'max', 'sorted', 'list')
+
+    def __init__(self):
+        self.result = dict()
+        super(RaggedArguments, self).__init__(Aliases, Ancestors,
+                                              DefUseChains)
+
+    def calls_builtin(self, node, names, module='builtins'):
+        aliases = self.aliases[node.func]
+        return bool(aliases) and all(
+            any(alias is MODULES[module][name] for name in names)
+            for alias in aliases)
+
+    def is_single_def(self, function, name):
+        """ Whether `name' is defined only once in `function'. """
+        defs = [d for d in self.def_use_chains.locals[function]
+                if d.name() == name.id]
+        return len(defs) == 1
+
+    def is_safe_target(self, function, target):
+        """ Whether the value bound to `target' is only read. """
+        if not isinstance(target, ast.Name):
+            return False
+        if not self.is_single_def(function, target):
+            return False
+        return all(self.is_safe_use(function, use.node, row=True)
+                   for use in self.def_use_chains.chains[target].users())
+
+    def is_safe_use(self, function, node, row):
+        """
+        Whether `node', an expression evaluating to the argument or to one of
+        its rows, is only read.
+        """
+        parent = self.ancestors[node][-1]
+
+        if isinstance(parent, ast.Subscript) and parent.value is node:
+            if not isinstance(parent.ctx, ast.Load):
+                return False
+            if row:
+                return True
+            if isinstance(parent.slice, ast.Slice):
+                return False
+            return self.is_safe_use(function, parent, row=True)
+
+        if isinstance(parent, ast.For) and parent.iter is node:
+            return row or self.is_safe_target(function, parent.target)
+
+        if isinstance(parent, ast.Call) and node in parent.args:
+            if row:
+                return self.calls_builtin(parent, self.ROW_READERS)
+            # numpy.array copies a ragged list of lists in bulk
+            return (self.calls_builtin(parent, ('len',)) or
+                    (parent.args[0] is node and
+                     self.calls_builtin(parent, ('array',), 'numpy')))
+
+        if isinstance(parent, ast.Compare) and node in parent.comparators:
+            return row and all(isinstance(op, (ast.In, ast.NotIn))
+                               for op in parent.ops)
+
+        return False
+
+    def visit_FunctionDef(self, node):
+        ragged = self.result[node.name] = set()
+        for i, arg in enumerate(node.args.args):
+            if not self.is_single_def(node, arg):
+                continue
+            users = self.def_use_chains.chains[arg].users()
+            if users and all(self.is_safe_use(node, use.node, row=False)
+                             for use in users):
+                ragged.add(i)
@@ -0,0 +1,81 @@
+"""
+SharedOperands gathers the variables read several times by a single statement.
+"""
+
+from pythran.analyses.ancestors import Ancestors
+from pythran.analyses.use_def_chain import DefUseChains
+from pythran.passmanager import FunctionAnalysis
+import pythran.metadata as metadata
+
+import gast as ast
+
+
+class SharedOperands(FunctionAnalysis):
+
+    """
+    Gather the names bound once, by an assignment, and only read as operands
+    of the arithmetic of a single statement, at least twice, or of a chain of
+    statements fused by ElementwiseFusion.
+
+    Such a value needs neither to be computed as a whole before that
+    statement, nor to be recomputed for each read: each of its elements can be
+    computed once, when the statement first reads it.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager
+    >>> pm = passmanager.PassManager("test")
+    >>> code = '''
+    ... def foo(a):
+    ...     x = a + 1
+    ...     y = a * 2
+    ...     z = a - 1
+    ...     w = -a
+    ...     w = w * w
+    ...     builtins.print(-z)
+    ...     return x * x + x, y + builtins.len(y), z * z, w'''
+    >>> sorted(pm.gather(SharedOperands, ast.parse(code)))
+    ['x']
+    """
+
+    # nodes that evaluate their operands more than once
+    REPEATED = (ast.ListComp, ast.SetComp, ast.DictComp, ast.GeneratorExp,
+                ast.Lambda)
+
+    def __init__(self):
+        self.result = set()
+        super(SharedOperands, self).__init__(Ancestors, DefUseChains)
+
+    def statement(self, node):
+        """ Statement `node' belongs to, or None if it may be repeated. """
+        for ancestor in reversed(self.ancestors[node]):
+            if isinstance(ancestor, SharedOperands.REPEATED):
+                return None
+            if isinstance(ancestor, ast.stmt):
+                return ancestor
+
+    def is_operand(self, node):
+        parent = self.ancestors[node][-1]
+        return isinstance(parent, (ast.BinOp, ast.UnaryOp))
+
+    def visit_FunctionDef(self, node):
+        defs = dict()
+        for def_ in self.def_use_chains.locals[node]:
+            defs.setdefault(def_.name(), []).append(def_)
+
+        for name, name_defs in defs.items():
+            if len(name_defs) != 1:
+                continue
+            def_, = name_defs
+            parent = self.ancestors[def_.node][-1]
+            if not isinstance(parent, ast.Assign):
+                continue
+            if len(parent.targets) != 1 or parent.targets[0] is not def_.node:
+                continue
+            uses = [use.node for use in def_.users()]
+            if len(uses) < 2 or not all(map(self.is_operand, uses)):
+                continue
+            statements = {self.statement(use) for use in uses}
+            if None in statements:
+                continue
+            if len(statements) == 1 or metadata.get(parent, metadata.Fused):
+                self.result.add(name)
@@ -8,6 +8,7 @@ from pythran.analyses import LocalNodeDeclarations, GlobalDeclarations, Scope
 from pythran.analyses import YieldPoints, IsAssigned, ASTMatcher, AST_any
 from pythran.analyses import RangeValues, PureExpressions, Dependencies
 from pythran.analyses import Immediates, Ancestors
+from pythran.conversion import mangle
 from pythran.cxxgen import Template, Include, Namespace, CompilationUnit
 from pythran.cxxgen import Statement, Block, AnnotatedStatement, Typedef, Label
 from pythran.cxxgen import Value, FunctionDeclaration, EmptyStatement, Nop
@@ -416,6 +417,13 @@ class CxxFunction(ast.NodeVisitor):
                         self.types.builder.NamedType(
                             'decltype({})'.format(value))),
                     alltargets)
+            elif isinstance(self.types[node.targets[0]],
+                            self.types.builder.Shared):
+                alltargets = '{} {}'.format(
+                    self.types.builder.Shared(
+                        self.types.builder.NamedType(
+                            'decltype({})'.format(value))),
+                    alltargets)
             else:
                 assert isinstance(self.types[node.targets[0]],
                                   self.types.builder.Lazy)
@@ -428,12 +436,27 @@ class CxxFunction(ast.NodeVisitor):
         return self.process_omp_attachements(node, stmt)
 
     def visit_AugAssign(self, node):
+        if isinstance(node.op, ast.Add) and self.is_dot_call(node.value):
+            # accumulate the product in place instead of through a temporary
+            args = [self.visit(arg) for arg in node.value.args]
+            target = self.visit(node.target)
+            stmt = Statement("pythonic::numpy::dot_accumulate({0})".format(
+                ", ".join([target] + args)))
+            return self.process_omp_attachements(node, stmt)
         value = self.visit(node.value)
         target = self.visit(node.target)
         op = update_operator_to_lambda[type(node.op)]
         stmt = Statement(op(target, value)[1:-1])  # strip spurious parenthesis
         return self.process_omp_attachements(node, stmt)
 
+    @staticmethod
+    def is_dot_call(node):
+        pattern = ast.Call(func=ast.Attribute(
+            value=ast.Name(mangle('numpy'), ast.Load(), None, None),
+            attr='dot', ctx=ast.Load()),
+            args=[AST_any(), AST_any()], keywords=[])
+        return node in ASTMatcher(pattern).search(node)
+
     def visit_Print(self, node):
         values = [self.visit(n) for n in node.values]
         stmt = Statement("pythonic::builtins::print{0}({1})".format(
@@ -764,7 +787,107 @@ class CxxFunction(ast.NodeVisitor):
         stmt = While(test, Block(body))
         return self.process_omp_attachements(node, stmt)
 
+    @staticmethod
+    def next_iterator(node):
+        """ `it` if node is next(it), None otherwise. """
+        pattern = ast.Call(func=ast.Attribute(
+            value=ast.Name('builtins', ast.Load(), None, None),
+            attr='next', ctx=ast.Load()),
+            args=[AST_any()], keywords=[])
+        if node not in ASTMatcher(pattern).search(node):
+            return None
+        if not isinstance(node.args[0], ast.Name):
+            return None
+        return node.args[0]
+
+    @staticmethod
+    def guarded_statement(node, exception):
+        """
+        (stmt, handler) if node is
+
+            try:
+                stmt
+            except exception:
+                ...
+
+        where stmt is an assignment or an expression, None otherwise.
+        """
+        if node.orelse or node.finalbody:
+            return None
+        if len(node.body) != 1 or len(node.handlers) != 1:
+            return None
+        stmt, handler = node.body[0], node.handlers[0]
+        pattern = ast.Attribute(
+            value=ast.Name('builtins', ast.Load(), None, None),
+            attr=exception, ctx=ast.Load())
+        if handler.name or handler.type is None:
+            return None
+        if handler.type not in ASTMatcher(pattern).search(handler.type):
+            return None
+        if not isinstance(stmt, (ast.Assign, ast.AugAssign, ast.Expr)):
+            return None
+        return stmt, handler
+
+    def visit_exhaustion_check(self, node):
+        """
+        Turns
+
+            try:
+                x = next(it)
+            except StopIteration:
+                ...
+
+        into a check of the exhaustion of `it`, so that the usual way of
+        consuming an iterator by hand does not go through an exception.
+        Returns None if node does not follow this pattern.
+        """
+        guarded = self.guarded_statement(node, 'StopIteration')
+        if guarded is None:
+            return None
+        stmt, handler = guarded
+        iterator = self.next_iterator(stmt.value)
+        if iterator is None:
+            return None
+        return If("pythonic::builtins::has_next({0})".format(
+                  self.visit(iterator)),
+                  Block([self.visit(stmt)]),
+                  Block([self.visit(n) for n in handler.body]))
+
+    def visit_key_check(self, node):
+        """
+        Turns
+
+            try:
+                x = d[k]
+            except KeyError:
+                ...
+
+        into a membership test, so that a missing key does not go through an
+        exception. The key is evaluated twice, so it must be a name or a
+        constant. Returns None if node does not follow this pattern.
+        """
+        guarded = self.guarded_statement(node, 'KeyError')
+        if guarded is None:
+            return None
+        stmt, handler = guarded
+        lookup = stmt.value
+        if not isinstance(lookup, ast.Subscript):
+            return None
+        if not isinstance(lookup.value, ast.Name):
+            return None
+        if not isinstance(lookup.slice, (ast.Name, ast.Constant)):
+            return None
+        return If("pythonic::builtins::has_key({0}, {1})".format(
+                  self.visit(lookup.value), self.visit(lookup.slice)),
+                  Block([self.visit(stmt)]),
+                  Block([self.visit(n) for n in handler.body]))
+
     def visit_Try(self, node):
+        check = self.visit_exhaustion_check(node)
+        if check is None:
+            check = self.visit_key_check(node)
+        if check is not None:
+            return check
         body = [self.visit(n) for n in node.body]
         except_ = list()
         for n in node.handlers:
@@ -1209,6 +1332,27 @@ class CxxGenerator(CxxFunction):
                       Statement("goto {0}".format(CxxGenerator.FinalStatement))
                       ])
 
+    def end_on_exhaustion(self, node, stmt):
+        """
+        Pythran ends a generator when it consumes an exhausted iterator
+        through next(it). Outside of any try block, nothing can catch the
+        resulting StopIteration in between, so the exhaustion is checked
+        beforehand and the generator ends without any exception.
+        """
+        iterator = self.next_iterator(node.value)
+        if iterator is None:
+            return stmt
+        if any(isinstance(n, ast.Try) for n in self.ancestors[node]):
+            return stmt
+        check = If("!pythonic::builtins::has_next({0})".format(
+                   self.visit(iterator)),
+                   self.visit_Return(None))
+        return Block([check, stmt])
+
+    def visit_Expr(self, node):
+        stmt = super(CxxGenerator, self).visit_Expr(node)
+        return self.end_on_exhaustion(node, stmt)
+
     def visit_Yield(self, node):
         num, label = self.yields[node]
         return "".join(n for n in Block([
@@ -1223,6 +1367,7 @@ class CxxGenerator(CxxFunction):
         targets = [self.visit(t) for t in node.targets]
         alltargets = "= ".join(targets)
         stmt = Assign(alltargets, value)
+        stmt = self.end_on_exhaustion(node, stmt)
         return self.process_omp_attachements(node, stmt)
 
     def can_use_autofor(self, node):
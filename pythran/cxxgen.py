@@ -502,37 +502,23 @@ class PythonModule(object):
             args_unboxing.append('from_python<{}>(args_obj[{}])'.format(t, i))
             args_checks.append('is_convertible<{}>(args_obj[{}])'.format(t, i))
         arg_decls = func.fdecl.arg_decls[:len(ctypes)]
-        keywords = "".join('"{}", '.format(arg.name) for arg in arg_decls)
+        keywords = [arg.name for arg in arg_decls]
         wrapper = dedent('''
             static PyObject *
-            {wname}(PyObject *self, PyObject *args, PyObject *kw)
+            {wname}(PyObject *const *args_obj)
             {{
-                PyObject* args_obj[{size}+1];
-                char const* keywords[] = {{{keywords} nullptr}};
-                if(! PyArg_ParseTupleAndKeywords(args, kw, "{fmt}",
-                                                 (char**)keywords {objs}))
-                    return nullptr;
-                if({checks})
-                    return to_python({name}({args}));
-                else {{
-                    return nullptr;
-                }}
+                return to_python({name}({args}));
             }}''')
 
         self.wrappers.append(
             wrapper.format(name=func.fdecl.name,
-                           size=len(ctypes),
-                           fmt="O" * len(ctypes),
-                           objs=''.join(', &args_obj[%d]' % i
-                                        for i in range(len(ctypes))),
                            args=', '.join(args_unboxing),
-                           checks=' && '.join(args_checks) or '1',
                            wname=wrapper_name,
-                           keywords=keywords,
                            )
         )
 
-        func_descriptor = wrapper_name, ctypes, signature
+        func_descriptor = (wrapper_name, ctypes, signature, keywords,
+                           ' && '.join(args_checks) or '1')
         self.functions.setdefault(name, []).append(func_descriptor)
 
     def add_global_var(self, name, init):
@@ -553,14 +539,44 @@ class PythonModule(object):
 
         for fname, overloads in self.functions.items():
             tryall = []
+            cases = []
             signatures = []
-            for overload, ctypes, signature in overloads:
+            keywords = max((overload[3] for overload in overloads), key=len)
+            size = len(keywords)
+            # overloads that name their parameters differently, such as the
+            # two forms of the batched entry points, are positional only
+            if any(overload[3] != keywords[:len(overload[3])]
+                   for overload in overloads):
+                keywords = []
+            # arrays with static dimensions cannot be summarized by a key
+            with_shape = any('std::integral_constant' in ctype
+                             for _, ctypes, _, _, _ in overloads
+                             for ctype in ctypes)
+            for index, (overload, ctypes, signature, _, checks) in \
+                    enumerate(overloads):
                 try_ = dedent("""
-                    if(PyObject* obj = {name}(self, args, kw))
-                        return obj;
-                    PyErr_Clear();
-                    """.format(name=overload))
+                    if(first <= {index} && n == {size} && {checks}) {{
+                        if(PyObject* obj = {name}(args_obj)) {{
+                            if(cacheable)
+                                table.insert(key, {index});
+                            return obj;
+                        }}
+                        PyErr_Clear();
+                    }}
+                    """.format(name=overload,
+                               index=index,
+                               size=len(ctypes),
+                               checks=checks))
                 tryall.append(try_)
+                case = dedent("""
+                    case {index}:
+                        if(PyObject* obj = {name}(args_obj))
+                            return obj;
+                        PyErr_Clear();
+                        first = {index} + 1;
+                        break;
+                    """.format(name=overload, index=index))
+                cases.append(case)
                 signatures.append(signature)
 
             candidates = signatures_to_string(fname, signatures)
@@ -569,16 +585,39 @@ class PythonModule(object):
 
             candidate = dedent('''
             static PyObject *
-            {wname}(PyObject *self, PyObject *args, PyObject *kw)
+            {wname}(PyObject *self, PYTHRAN_FASTCALL_PARAMS)
             {{
-                return pythonic::handle_python_exception([self, args, kw]()
-                -> PyObject* {{
+                return pythonic::handle_python_exception([&]() -> PyObject* {{
+                static char const* const keywords[] = {{{keywords} nullptr}};
+                static pythonic::python::dispatch_table<{size}> table;
+                PyObject* args_obj[{size}+1];
+                long n = pythonic::python::parse_args(args_obj, {size},
+                                                      keywords,
+                                                      PYTHRAN_FASTCALL_ARGS);
+                pythonic::python::dispatch_key<{size}> key;
+                bool cacheable =
+                    n >= 0 &&
+                    pythonic::python::make_dispatch_key<{with_shape}, {size}>(
+                        key, args_obj, n);
+                long first = 0;
+                if(cacheable) {{
+                    switch(table.lookup(key)) {{
+                    {cases}
+                    default:
+                        break;
+                    }}
+                }}
                 {tryall}
                 return pythonic::python::raise_invalid_argument(
-                               "{name}", {candidates}, args, kw);
+                               "{name}", {candidates}, PYTHRAN_FASTCALL_ARGS);
                 }});
             }}
             '''.format(name=fname,
+                       size=size,
+                       keywords="".join('"{}", '.format(kw)
+                                        for kw in keywords),
+                       with_shape='true' if with_shape else 'false',
+                       cases="\n".join(cases),
                        tryall="\n".join(tryall),
                        candidates=self.splitstring(
                            candidates.replace('\n', '\\n')
@@ -588,8 +627,8 @@ class PythonModule(object):
             fdoc = self.docstring(self.docstrings.get(fname, ''))
             themethod = dedent('''{{
                 "{name}",
-                (PyCFunction){wname},
-                METH_VARARGS | METH_KEYWORDS,
+                (PyCFunction)(void (*)(void)){wname},
+                PYTHRAN_METH_FASTCALL | METH_KEYWORDS,
                 {doc}}}'''.format(name=fname,
                                   wname=wrapper_name,
                                   doc=fdoc))
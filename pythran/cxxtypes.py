@@ -52,6 +52,9 @@ type>::type
     >>> builder.Lazy(builder.NamedType("long"))
     typename pythonic::lazy<long>::type
 
+    >>> builder.Shared(builder.NamedType("long"))
+    typename pythonic::shared<long>::type
+
     >>> builder.DeclType("toto")
     typename std::remove_cv<\
 typename std::remove_reference<decltype(toto)>::type>::type
@@ -317,6 +320,19 @@ std::declval<bool>()))
             def generate(self, ctx):
                 return 'typename pythonic::lazy<{}>::type'.format(ctx(self.of))
 
+        class Shared(DependentType):
+            """
+            A type read several times by a single statement
+
+            It is used to compute each element of a numpy expression once,
+            when that statement needs it
+
+            """
+
+            def generate(self, ctx):
+                return 'typename pythonic::shared<{}>::type'.format(
+                    ctx(self.of))
+
         class DeclType(NamedType):
             """
             Gather the type of a variable
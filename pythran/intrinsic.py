@@ -61,7 +61,7 @@ class Intrinsic(object):
             [], None,
             [ast.Name(n, ast.Param(), None, None)
              for n in kwargs.get('kwonlyargs', [])],
-            [], None,
+            [to_ast(d) for d in kwargs.get('kwonlydefaults', [])], None,
             [to_ast(d) for d in kwargs.get('defaults', [])])
         self.return_range = kwargs.get("return_range",
                                        lambda call: UNKNOWN_RANGE)
@@ -39,6 +39,11 @@ class Comprehension(AST):
             self.target = args[0]
 
 
+class Fused(AST):
+
+    """ Metadata to mark a value evaluated by the statements reading it. """
+
+
 class StaticReturn(AST):
 
     """ Metadata to mark return with a constant value. """
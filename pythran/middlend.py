@@ -5,7 +5,8 @@ from pythran.optimizations import (ComprehensionPatterns, ListCompToGenexp,
                                    RemoveDeadFunctions)
 from pythran.transformations import (ExpandBuiltins, ExpandImports,
                                      ExpandImportAll, FalsePolymorphism,
-                                     NormalizeCompare, NormalizeException,
+                                     NormalizeCompare, NormalizeEinsum,
+                                     NormalizeException,
                                      NormalizeMethodCalls, NormalizeReturn,
                                      NormalizeTuples, RemoveComprehension,
                                      RemoveNestedFunctions, RemoveLambdas,
@@ -47,6 +48,7 @@ def refine(pm, node, optimizations):
     pm.apply(ListCompToGenexp, node)
     pm.apply(RemoveComprehension, node)
     pm.apply(RemoveNamedArguments, node)
+    pm.apply(NormalizeEinsum, node)
 
     # sanitize input
     pm.apply(NormalizeReturn, node)
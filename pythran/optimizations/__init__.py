@@ -12,6 +12,7 @@ import optimisations.xxxxx
 
 from .constant_folding import ConstantFolding, PartialConstantFolding
 from .dead_code_elimination import DeadCodeElimination
+from .elementwise_fusion import ElementwiseFusion
 from .forward_substitution import ForwardSubstitution
 from .iter_transformation import IterTransformation
 from .comprehension_patterns import ComprehensionPatterns
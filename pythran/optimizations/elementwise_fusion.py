@@ -0,0 +1,128 @@
+"""
+ElementwiseFusion fuses chains of elementwise array statements.
+"""
+
+from pythran.analyses import Ancestors, DefUseChains
+from pythran.passmanager import Transformation
+import pythran.metadata as metadata
+
+import gast as ast
+import logging
+
+logger = logging.getLogger('pythran')
+
+
+class ElementwiseFusion(Transformation):
+
+    """
+    Fuse consecutive elementwise statements whose results are only read by
+    the next statements of the chain.
+
+    The intermediate results of such a chain that are read several times are
+    marked as candidates for not being evaluated as a whole: when their type
+    allows it, their elements are computed one block at a time, when the
+    statement ending the chain reads them, so that large arrays are streamed
+    through the cache once.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager
+    >>> pm = passmanager.PassManager("test")
+    >>> code = '''
+    ... def foo(a):
+    ...     b = a * 2
+    ...     c = b + 1
+    ...     d = b * c
+    ...     e = d - 1
+    ...     return e, d'''
+    >>> node = ast.parse(code)
+    >>> _, node = pm.apply(ElementwiseFusion, node)
+    >>> [stmt.targets[0].id for stmt in node.body[0].body
+    ...  if metadata.get(stmt, metadata.Fused)]
+    ['b']
+    """
+
+    # nodes that evaluate their operands more than once
+    REPEATED = (ast.ListComp, ast.SetComp, ast.DictComp, ast.GeneratorExp,
+                ast.Lambda)
+
+    def __init__(self):
+        super(ElementwiseFusion, self).__init__(Ancestors, DefUseChains)
+
+    def is_single_def(self, name):
+        defs = [d for d in self.def_use_chains.locals[self.ctx.function]
+                if d.name() == name.id]
+        return len(defs) == 1
+
+    def candidate_uses(self, stmt):
+        """
+        Reads of the array defined by `stmt', if it is an elementwise
+        statement whose result is only read elementwise, None otherwise.
+        """
+        if not isinstance(stmt, ast.Assign) or len(stmt.targets) != 1:
+            return None
+        target, = stmt.targets
+        if not isinstance(target, ast.Name) or not self.is_single_def(target):
+            return None
+        if not isinstance(stmt.value, (ast.BinOp, ast.UnaryOp)):
+            return None
+        uses = [use.node for use in self.def_use_chains.chains[target].users()]
+        operators = ast.BinOp, ast.UnaryOp
+        if not uses or not all(isinstance(self.ancestors[use][-1], operators)
+                               for use in uses):
+            return None
+        return uses
+
+    def position(self, node, index):
+        """
+        Index of the statement holding `node' in the statement list indexed
+        by `index', or None if it is nested into another statement or may be
+        evaluated several times.
+        """
+        for ancestor in reversed(self.ancestors[node]):
+            if isinstance(ancestor, ElementwiseFusion.REPEATED):
+                return None
+            if isinstance(ancestor, ast.stmt):
+                return index.get(ancestor)
+
+    def fuse(self, stmts):
+        index = {stmt: i for i, stmt in enumerate(stmts)}
+        i = 0
+        while i < len(stmts):
+            chain = []
+            while i < len(stmts):
+                uses = self.candidate_uses(stmts[i])
+                if uses is None:
+                    break
+                chain.append((i, uses))
+                i += 1
+
+            # the first statement that is not elementwise ends the chain
+            fused, last = [], 0
+            for k, uses in chain:
+                positions = [self.position(use, index) for use in uses]
+                if all(p is not None and k < p <= i for p in positions):
+                    fused.append((stmts[k], uses))
+                    last = max([last] + positions)
+            i += 1
+
+            # values read once are already evaluated lazily; the others are
+            # only candidates, as their type may still require evaluating
+            # them as a whole
+            new = [stmt for stmt, uses in fused
+                   if len(uses) > 1 and
+                   not metadata.get(stmt, metadata.Fused)]
+            for stmt in new:
+                metadata.add(stmt, metadata.Fused())
+            if new:
+                logger.info("Candidates for fused evaluation into line {}: {}"
+                            .format(getattr(stmts[last], 'lineno', '?'),
+                                    ", ".join(stmt.targets[0].id
+                                              for stmt in new)))
+
+    def visit_FunctionDef(self, node):
+        for child in ast.walk(node):
+            for field in ('body', 'orelse', 'finalbody'):
+                stmts = getattr(child, field, None)
+                if isinstance(stmts, list):
+                    self.fuse(stmts)
+        return node
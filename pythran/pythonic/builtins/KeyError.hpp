@@ -11,6 +11,24 @@ namespace builtins
 {
 
   PYTHONIC_EXCEPTION_IMPL(KeyError)
+
+  template <class T, class K>
+  bool has_key(T const &, K const &)
+  {
+    return true;
+  }
+
+  template <class K, class V, class T>
+  bool has_key(types::dict<K, V> const &self, T const &key)
+  {
+    return self.contains(key);
+  }
+
+  template <class T>
+  bool has_key(types::empty_dict const &, T const &)
+  {
+    return false;
+  }
 }
 PYTHONIC_NS_END
 
@@ -5,7 +5,9 @@
 
 #include "pythonic/builtins/StopIteration.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/yield.hpp"
 
+#include <type_traits>
 #include <utility>
 
 PYTHONIC_NS_BEGIN
@@ -13,15 +15,61 @@ PYTHONIC_NS_BEGIN
 namespace builtins
 {
 
-  template <class T>
-  auto next(T &&y) -> decltype(*y)
+  namespace details
   {
-    if ((decltype(y.begin()) &)y != y.end()) {
+    // iterators are positioned on their next value
+    template <class T>
+    bool has_next(T &&y, std::false_type)
+    {
+      return (decltype(y.begin()) &)y != y.end();
+    }
+
+    template <class T>
+    auto next(T &&y, std::false_type) -> decltype(*y)
+    {
+      if (!has_next(y, std::false_type{}))
+        throw types::StopIteration();
       auto &&tmp = *y;
       ++y;
       return tmp;
-    } else
-      throw types::StopIteration();
+    }
+
+    /* Generators compute their next value on demand, so that checking for
+     * it computes it ahead, leaving it pending until next() consumes it.
+     */
+    template <class T>
+    bool has_next(T &&y, std::true_type)
+    {
+      if (!y.__generator_pending && y.__generator_state != -1) {
+        y.next();
+        y.__generator_pending = y.__generator_state != -1;
+      }
+      return y.__generator_pending;
+    }
+
+    template <class T>
+    auto next(T &&y, std::true_type) -> decltype(*y)
+    {
+      if (!has_next(y, std::true_type{}))
+        throw types::StopIteration();
+      y.__generator_pending = false;
+      return *y;
+    }
+
+    template <class T>
+    using is_generator = std::is_base_of<yielder, typename std::decay<T>::type>;
+  }
+
+  template <class T>
+  auto next(T &&y) -> decltype(*y)
+  {
+    return details::next(y, details::is_generator<T>{});
+  }
+
+  template <class T>
+  bool has_next(T &&y)
+  {
+    return details::has_next(y, details::is_generator<T>{});
   }
 }
 PYTHONIC_NS_END
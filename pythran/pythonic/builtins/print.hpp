@@ -3,8 +3,13 @@
 
 #include "pythonic/include/builtins/print.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/output_buffer.hpp"
+#include "pythonic/utils/seq.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/types/str.hpp"
 
-#include <iostream>
+#include <ostream>
+#include <tuple>
 
 PYTHONIC_NS_BEGIN
 
@@ -14,43 +19,191 @@ namespace builtins
   namespace details
   {
     template <class T>
-    std::ostream &print(std::ostream &os, T const &t)
+    void print(utils::output_buffer &out, T const &t, std::false_type)
     {
-      return os << t;
+      std::ostream os(&out);
+      os << t;
     }
 
-    std::ostream &print(std::ostream &os, bool const &t)
+    template <class T>
+    void print(utils::output_buffer &out, T const &t, std::true_type)
     {
-      static char const repr[2][6] = {"False", "True\0"};
-      return os << repr[t];
+      utils::write_integer(out, t);
     }
-  }
 
-  void print_nonl()
-  {
-  }
+    template <class T>
+    void print(utils::output_buffer &out, T const &t)
+    {
+      // char is a character and bool has its own representation
+      print(out, t, std::integral_constant<
+                        bool, std::is_integral<T>::value &&
+                                  !std::is_same<T, bool>::value &&
+                                  !std::is_same<T, char>::value>{});
+    }
 
-  template <typename T, typename... Types>
-  void print_nonl(T const &value, Types const &... values)
-  {
-    details::print(std::cout, value);
-    if (sizeof...(Types) > 0)
-      std::cout << ' ';
-    print_nonl(values...);
+    void print(utils::output_buffer &out, bool t)
+    {
+      if (t)
+        out.write("True", 4);
+      else
+        out.write("False", 5);
+    }
+
+    void print(utils::output_buffer &out, double t)
+    {
+      utils::write_float(out, t);
+    }
+
+    void print(utils::output_buffer &out, float t)
+    {
+      utils::write_float(out, t);
+    }
+
+    void print(utils::output_buffer &out, types::str const &t)
+    {
+      out.write(t.c_str(), t.size());
+    }
+
+    // sep and end, given as a str or as None for their default value
+    void print_text(utils::output_buffer &out, types::str const &text,
+                    char)
+    {
+      out.write(text.c_str(), text.size());
+    }
+
+    void print_text(utils::output_buffer &out, types::none_type, char text)
+    {
+      out.put(text);
+    }
+
+    template <class Sep>
+    void print_values(utils::output_buffer &, Sep const &)
+    {
+    }
+
+    template <class Sep, class T, class... Types>
+    void print_values(utils::output_buffer &out, Sep const &sep,
+                      T const &value, Types const &... values)
+    {
+      print(out, value);
+      if (sizeof...(Types))
+        print_text(out, sep, ' ');
+      print_values(out, sep, values...);
+    }
+
+    inline bool print_flush(bool flush)
+    {
+      return flush;
+    }
+
+    inline bool print_flush(types::none_type)
+    {
+      return false;
+    }
+
+    template <class Sep, class End, class... Types>
+    void print_to(types::none_type, Sep const &sep, End const &end,
+                  bool flush, Types const &... values)
+    {
+      utils::stdio_buffer &out = utils::stdout_buffer();
+      std::lock_guard<std::mutex> guard(out.mutex());
+      print_values(out, sep, values...);
+      print_text(out, end, '\n');
+      if (flush)
+        out.flush();
+      else if (out.interactive())
+        // a terminal gets each line, as it would from Python
+        out.pubsync();
+    }
+
+    // Buffer of a single print call to a file object
+    template <class F>
+    class file_buffer : public utils::output_buffer
+    {
+      F file_;
+
+    protected:
+      void drain(char const *s, std::size_t n) override
+      {
+        file_.write(s, n);
+      }
+
+    public:
+      file_buffer(F const &file) : file_(file)
+      {
+      }
+      ~file_buffer()
+      {
+        sync();
+      }
+    };
+
+    template <class F, class Sep, class End, class... Types>
+    void print_to(F const &file, Sep const &sep, End const &end, bool flush,
+                  Types const &... values)
+    {
+      file_buffer<F> out(file);
+      print_values(out, sep, values...);
+      print_text(out, end, '\n');
+      out.pubsync();
+      if (flush)
+        F(file).flush();
+    }
+
+    // number of values before the types::kwonly marker, if any
+    template <class... Types>
+    struct print_arity;
+
+    template <>
+    struct print_arity<> : std::integral_constant<std::size_t, 0> {
+    };
+
+    template <class... Types>
+    struct print_arity<types::kwonly, Types...>
+        : std::integral_constant<std::size_t, 0> {
+    };
+
+    template <class T, class... Types>
+    struct print_arity<T, Types...>
+        : std::integral_constant<std::size_t,
+                                 1 + print_arity<Types...>::value> {
+    };
+
+    template <class Args, std::size_t... Is>
+    void print_args(Args const &args, utils::index_sequence<Is...>,
+                    std::false_type)
+    {
+      print_to(types::none_type{}, types::none_type{}, types::none_type{},
+               false, std::get<Is>(args)...);
+    }
+
+    template <class Args, std::size_t... Is>
+    void print_args(Args const &args, utils::index_sequence<Is...>,
+                    std::true_type)
+    {
+      static constexpr std::size_t kwonly = sizeof...(Is);
+      print_to(std::get<kwonly + 3>(args), std::get<kwonly + 1>(args),
+               std::get<kwonly + 2>(args),
+               print_flush(std::get<kwonly + 4>(args)),
+               std::get<Is>(args)...);
+    }
   }
 
-  void print()
+  template <class... Types>
+  void print_nonl(Types const &... values)
   {
-    std::cout << std::endl;
+    details::print_to(types::none_type{}, types::none_type{}, types::str(),
+                      false, values...);
   }
 
-  template <typename T, typename... Types>
-  void print(T const &value, Types const &... values)
+  template <class... Types>
+  void print(Types const &... values)
   {
-    details::print(std::cout, value);
-    if (sizeof...(values) > 0)
-      std::cout << ' ';
-    print(values...);
+    using arity = details::print_arity<Types...>;
+    details::print_args(std::tie(values...),
+                        utils::make_index_sequence<arity::value>{},
+                        std::integral_constant<bool, arity::value !=
+                                                         sizeof...(Types)>{});
   }
 }
 PYTHONIC_NS_END
@@ -5,10 +5,28 @@
 
 PYTHONIC_NS_BEGIN
 
+namespace types
+{
+  template <class K, class V>
+  class dict;
+  struct empty_dict;
+}
+
 namespace builtins
 {
 
   PYTHONIC_EXCEPTION_DECL(KeyError)
+
+  /* Whether subscripting `self` with `key` does not raise a KeyError, so
+   * that a lookup guarded by `except KeyError` can be turned into a test.
+   * Only dictionaries raise KeyError on subscript.
+   */
+  template <class T, class K>
+  bool has_key(T const &self, K const &key);
+  template <class K, class V, class T>
+  bool has_key(types::dict<K, V> const &self, T const &key);
+  template <class T>
+  bool has_key(types::empty_dict const &self, T const &key);
 }
 PYTHONIC_NS_END
 
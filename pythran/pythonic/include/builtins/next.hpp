@@ -2,6 +2,7 @@
 #define PYTHONIC_INCLUDE_BUILTIN_NEXT_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/yield.hpp"
 
 #include <utility>
 
@@ -13,6 +14,13 @@ namespace builtins
   template <class T>
   auto next(T &&y) -> decltype(*y);
 
+  /* Whether next(y) would return instead of raising StopIteration, so that
+   * exhaustion can be handled without an exception. A generator computes
+   * its next value to tell, next(y) then returns it.
+   */
+  template <class T>
+  bool has_next(T &&y);
+
   DEFINE_FUNCTOR(pythonic::builtins, next);
 }
 PYTHONIC_NS_END
@@ -1,23 +1,26 @@
 #ifndef PYTHONIC_INCLUDE_BUILTIN_PRINT_HPP
 #define PYTHONIC_INCLUDE_BUILTIN_PRINT_HPP
 
-#include <ostream>
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/output_buffer.hpp"
+#include "pythonic/include/builtins/pythran/kwonly.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace builtins
 {
 
-  void print_nonl();
+  /* Values are written to the buffer of their target, stdout by default,
+   * which is only flushed when full, on request, at exit or when control
+   * goes back to Python. Keyword arguments come after a types::kwonly marker
+   * as sep, end, file and flush, None standing for their default value.
+   */
+  template <class... Types>
+  void print_nonl(Types const &... values);
 
-  template <typename T, typename... Types>
-  void print_nonl(T const &value, Types const &... values);
+  template <class... Types>
+  void print(Types const &... values);
 
-  void print();
-
-  template <typename T, typename... Types>
-  void print(T const &value, Types const &... values);
   DEFINE_FUNCTOR(pythonic::builtins, print);
 }
 PYTHONIC_NS_END
@@ -0,0 +1,24 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_ARGPARTITION_HPP
+#define PYTHONIC_INCLUDE_NUMPY_ARGPARTITION_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/partition.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class K>
+  types::ndarray<long, types::array<long, E::value>>
+  argpartition(E const &a, K const &kth, long axis = -1);
+
+  template <class E, class K>
+  types::ndarray<long, types::array<long, 1>>
+  argpartition(E const &a, K const &kth, types::none_type);
+
+  DEFINE_FUNCTOR(pythonic::numpy, argpartition);
+}
+PYTHONIC_NS_END
+
+#endif
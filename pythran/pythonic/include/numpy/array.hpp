@@ -1,14 +1,26 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_ARRAY_HPP
 #define PYTHONIC_INCLUDE_NUMPY_ARRAY_HPP
 
+#include "pythonic/include/utils/avoided_copies.hpp"
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/nested_container.hpp"
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/ragged.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class A, class I, class T>
+    A make_array(I &&iterable, T const *);
+
+    // rows of equal size are copied as a whole
+    template <class A, class I, class T>
+    A make_array(I &&rows, types::ragged<T> const *);
+  }
+
   template <class T,
             class dtype = types::dtype_t<typename std::decay<T>::type::dtype>>
   typename std::enable_if<
@@ -41,6 +53,10 @@ namespace numpy
   template <class T, class pS>
   types::ndarray<T, pS> array(types::ndarray<T, pS> const &arr);
 
+  // a temporary array nobody else refers to is returned as is
+  template <class T, class pS>
+  types::ndarray<T, pS> array(types::ndarray<T, pS> &&arr);
+
   template <class T, size_t N, class V, class dtype = types::dtype_of<T>>
   types::ndarray<typename dtype::type,
                  typename types::array_base<T, N, V>::shape_t>
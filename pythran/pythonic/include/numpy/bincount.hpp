@@ -1,8 +1,9 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_BINCOUNT_HPP
 #define PYTHONIC_INCLUDE_NUMPY_BINCOUNT_HPP
 
-#include "pythonic/include/numpy/max.hpp"
-#include "pythonic/include/utils/numpy_conversion.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/histogram.hpp"
+#include "pythonic/include/utils/stream.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -24,7 +25,23 @@ namespace numpy
   bincount(types::ndarray<T, pS> const &expr, E const &weights,
            types::none<long> minlength = builtins::None);
 
-  NUMPY_EXPR_TO_NDARRAY0_DECL(bincount);
+  // expressions are counted block by block, without being evaluated first
+  template <class E>
+  typename std::enable_if<!types::is_ndarray<E>::value &&
+                              types::is_array<E>::value && E::value == 1,
+                          types::ndarray<long, types::pshape<long>>>::type
+  bincount(E const &expr, types::none_type weights = builtins::None,
+           types::none<long> minlength = builtins::None);
+
+  template <class E, class W>
+  typename std::enable_if<
+      !types::is_ndarray<E>::value && types::is_array<E>::value &&
+          E::value == 1,
+      types::ndarray<decltype(std::declval<long>() *
+                              std::declval<typename W::dtype>()),
+                     types::pshape<long>>>::type
+  bincount(E const &expr, W const &weights,
+           types::none<long> minlength = builtins::None);
 
   DEFINE_FUNCTOR(pythonic::numpy, bincount);
 }
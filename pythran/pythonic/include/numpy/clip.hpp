@@ -15,6 +15,17 @@ namespace numpy
 
     template <class T, class Mi>
     typename __combined<T, Mi>::type clip(T const &v, Mi a_min);
+
+#ifdef USE_XSIMD
+    template <class T, size_t N>
+    xsimd::batch<T, N> clip(xsimd::batch<T, N> const &v,
+                            xsimd::batch<T, N> const &a_min,
+                            xsimd::batch<T, N> const &a_max);
+
+    template <class T, size_t N>
+    xsimd::batch<T, N> clip(xsimd::batch<T, N> const &v,
+                            xsimd::batch<T, N> const &a_min);
+#endif
   }
 
 #define NUMPY_NARY_FUNC_NAME clip
@@ -4,6 +4,23 @@
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 
+/* Window length from which correlations and convolutions switch from the
+ * direct method to FFT-based overlap-save, and number of outputs computed per
+ * pass by the direct method. Defined as macros so that an enlightened user can
+ * modify these variables :-)
+ */
+#ifndef PYTHRAN_CORRELATE_FFT_SIZE
+#define PYTHRAN_CORRELATE_FFT_SIZE 64
+#endif
+
+#ifndef PYTHRAN_CORRELATE_BLOCK_SIZE
+#define PYTHRAN_CORRELATE_BLOCK_SIZE 64
+#endif
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
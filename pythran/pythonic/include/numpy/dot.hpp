@@ -180,14 +180,6 @@ namespace numpy
                           types::ndarray<E, types::array<long, 2>>>::type
   dot(types::ndarray<E, pS0> const &a, types::ndarray<E, pS1> const &b);
 
-  template <class E, class pS0, class pS1, class pS2>
-  typename std::enable_if<
-      is_blas_type<E>::value && std::tuple_size<pS0>::value == 2 &&
-          std::tuple_size<pS1>::value == 2 && std::tuple_size<pS2>::value == 2,
-      types::ndarray<E, pS2>>::type &
-  dot(types::ndarray<E, pS0> const &a, types::ndarray<E, pS1> const &b,
-      types::ndarray<E, pS2> &c);
-
   // texpr variants: MT, TM, TT
   template <class E, class pS0, class pS1>
   typename std::enable_if<is_blas_type<E>::value &&
@@ -240,6 +232,32 @@ namespace numpy
           types::array<long, 2>>>::type
   dot(E const &e, F const &f);
 
+  /// Products written into a preallocated array, as numpy's out argument.
+
+  // Contiguous operands of the dtype of out that do not share memory with it
+  // are multiplied in place, the others through a temporary.
+  template <class E, class F, class T, class pS>
+  typename std::enable_if<
+      types::is_numexpr_arg<E>::value && types::is_numexpr_arg<F>::value &&
+          E::value <= 2 && F::value <= 2 && E::value + F::value >= 3 &&
+          std::tuple_size<pS>::value == E::value + F::value - 2,
+      types::ndarray<T, pS>>::type &
+  dot(E const &e, F const &f, types::ndarray<T, pS> &out);
+
+  /* x += dot(e, f), generated for augmented assignments. When x has the
+   * shape and dtype of the product, it is accumulated in place through the
+   * beta argument of gemm.
+   */
+  template <class X, class E, class F>
+  void dot_accumulate(X &&x, E const &e, F const &f);
+
+  template <class T, class pS, class E, class F>
+  typename std::enable_if<
+      types::is_numexpr_arg<E>::value && types::is_numexpr_arg<F>::value &&
+          E::value <= 2 && F::value <= 2 && E::value + F::value >= 3 &&
+          std::tuple_size<pS>::value == E::value + F::value - 2>::type
+  dot_accumulate(types::ndarray<T, pS> &x, E const &e, F const &f);
+
   DEFINE_FUNCTOR(pythonic::numpy, dot);
 }
 PYTHONIC_NS_END
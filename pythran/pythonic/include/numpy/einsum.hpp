@@ -0,0 +1,38 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_EINSUM_HPP
+#define PYTHONIC_INCLUDE_NUMPY_EINSUM_HPP
+
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/types/str.hpp"
+#include "pythonic/include/utils/contract.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <long R, class T>
+    struct einsum_result {
+      using type = types::ndarray<T, types::array<long, R>>;
+    };
+    template <class T>
+    struct einsum_result<0, T> {
+      using type = T;
+    };
+  }
+
+  /* The rank of the result is computed at compile time from the literal
+   * subscripts and passed as first argument.
+   */
+  template <long R, class... Ops>
+  typename details::einsum_result<
+      R, typename __combined<typename types::dtype_of<Ops>::type...>::type>::
+      type
+      einsum(std::integral_constant<long, R>, types::str const &subscripts,
+             Ops const &... ops);
+
+  DEFINE_FUNCTOR(pythonic::numpy, einsum);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAM_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAM_HPP
+
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/builtins/None.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/utils/histogram.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // Counts are integers, unless weighted or normalized.
+    template <class W, class D>
+    struct histogram_count {
+      using type = double;
+    };
+    template <class W>
+    struct histogram_count<W, types::none_type> {
+      using type = typename types::dtype_of<W>::type;
+    };
+    template <>
+    struct histogram_count<types::none_type, types::none_type> {
+      using type = long;
+    };
+  }
+
+  template <class E, class B = long, class R = types::none_type,
+            class D = types::none_type, class W = types::none_type>
+  std::tuple<
+      types::ndarray<typename details::histogram_count<W, D>::type,
+                     types::pshape<long>>,
+      types::ndarray<double, types::pshape<long>>>
+  histogram(E const &a, B const &bins = 10, R const &range = builtins::None,
+            D const &density = builtins::None,
+            W const &weights = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogram);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAM2D_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAM2D_HPP
+
+#include "pythonic/include/numpy/histogramdd.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class X, class Y, class B = long, class R = types::none_type,
+            class D = types::none_type, class W = types::none_type>
+  std::tuple<types::ndarray<typename details::histogram_count<W, D>::type,
+                            types::array<long, 2>>,
+             types::ndarray<double, types::pshape<long>>,
+             types::ndarray<double, types::pshape<long>>>
+  histogram2d(X const &x, Y const &y, B const &bins = 10,
+              R const &range = builtins::None,
+              D const &density = builtins::None,
+              W const &weights = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogram2d);
+}
+PYTHONIC_NS_END
+
+#endif
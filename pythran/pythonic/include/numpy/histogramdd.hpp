@@ -0,0 +1,34 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAMDD_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAMDD_HPP
+
+#include "pythonic/include/numpy/histogram.hpp"
+#include "pythonic/include/types/list.hpp"
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  /* The sample is a tuple of D one-dimensional arrays, one per coordinate,
+   * so that the dimension of the histogram is known at compile time. `bins'
+   * and `range' are either shared by all dimensions or given per dimension as
+   * a tuple.
+   */
+  template <class S, class B = long, class R = types::none_type,
+            class D = types::none_type, class W = types::none_type>
+  std::tuple<types::ndarray<typename details::histogram_count<W, D>::type,
+                            types::array<long, std::tuple_size<S>::value>>,
+             types::list<types::ndarray<double, types::pshape<long>>>>
+  histogramdd(S const &sample, B const &bins = 10,
+              R const &range = builtins::None,
+              D const &density = builtins::None,
+              W const &weights = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogramdd);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_LINALG_CHOLESKY_HPP
+#define PYTHONIC_INCLUDE_NUMPY_LINALG_CHOLESKY_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    template <class E>
+    types::ndarray<typename utils::linalg_type<typename E::dtype>::type,
+                   types::array<long, E::value>>
+    cholesky(E const &a);
+
+    DEFINE_FUNCTOR(pythonic::numpy::linalg, cholesky);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
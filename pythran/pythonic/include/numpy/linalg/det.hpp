@@ -0,0 +1,31 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_LINALG_DET_HPP
+#define PYTHONIC_INCLUDE_NUMPY_LINALG_DET_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    template <class E>
+    typename std::enable_if<
+        E::value == 2,
+        typename utils::linalg_type<typename E::dtype>::type>::type
+    det(E const &a);
+
+    template <class E>
+    typename std::enable_if<
+        (E::value > 2),
+        types::ndarray<typename utils::linalg_type<typename E::dtype>::type,
+                       types::array<long, E::value - 2>>>::type
+    det(E const &a);
+
+    DEFINE_FUNCTOR(pythonic::numpy::linalg, det);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
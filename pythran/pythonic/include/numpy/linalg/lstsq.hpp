@@ -0,0 +1,42 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_LINALG_LSTSQ_HPP
+#define PYTHONIC_INCLUDE_NUMPY_LINALG_LSTSQ_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    namespace details
+    {
+      template <class A, class B>
+      struct lstsq_type {
+        using dtype = typename utils::linalg_type<typename __combined<
+            typename A::dtype, typename B::dtype>::type>::type;
+        using real = decltype(std::abs(std::declval<dtype>()));
+        using type =
+            std::tuple<types::ndarray<dtype, types::array<long, B::value>>,
+                       types::ndarray<real, types::array<long, 1>>, long,
+                       types::ndarray<real, types::array<long, 1>>>;
+      };
+    }
+
+    // Least-squares solution, residuals, rank and singular values of a
+    template <class A, class B>
+    typename details::lstsq_type<A, B>::type
+    lstsq(A const &a, B const &b, types::none_type rcond = {});
+
+    template <class A, class B>
+    typename details::lstsq_type<A, B>::type lstsq(A const &a, B const &b,
+                                                   double rcond);
+
+    DEFINE_FUNCTOR(pythonic::numpy::linalg, lstsq);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
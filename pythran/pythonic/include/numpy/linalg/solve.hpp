@@ -0,0 +1,27 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_LINALG_SOLVE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_LINALG_SOLVE_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    /* b is a stack of vectors if it has one dimension less than a, and a
+     * stack of matrices otherwise.
+     */
+    template <class A, class B>
+    types::ndarray<typename utils::linalg_type<typename __combined<
+                       typename A::dtype, typename B::dtype>::type>::type,
+                   types::array<long, B::value>>
+    solve(A const &a, B const &b);
+
+    DEFINE_FUNCTOR(pythonic::numpy::linalg, solve);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_MATMUL_HPP
+#define PYTHONIC_INCLUDE_NUMPY_MATMUL_HPP
+
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/numpy/dot.hpp"
+#include "pythonic/include/utils/contract.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // Rank of the result of matmul: broadcast batch dimensions, then the
+    // rows of the first operand and the columns of the second one, unless
+    // they are vectors.
+    template <size_t N0, size_t N1>
+    struct matmul_rank {
+      static constexpr size_t batch0 = N0 > 2 ? N0 - 2 : 0;
+      static constexpr size_t batch1 = N1 > 2 ? N1 - 2 : 0;
+      static constexpr size_t value = (batch0 > batch1 ? batch0 : batch1) +
+                                      (N0 >= 2 ? 1 : 0) + (N1 >= 2 ? 1 : 0);
+    };
+  }
+
+  // Matrices and vectors are handled by dot
+  template <class E, class F>
+  auto matmul(E const &e, F const &f) -> typename std::enable_if<
+      (E::value <= 2 && F::value <= 2), decltype(dot(e, f))>::type;
+
+  // Stacks of matrices, multiplied pairwise with broadcasting
+  template <class E, class F>
+  typename std::enable_if<
+      (E::value > 2 || F::value > 2),
+      types::ndarray<
+          typename __combined<typename E::dtype, typename F::dtype>::type,
+          types::array<long, details::matmul_rank<E::value,
+                                                  F::value>::value>>>::type
+  matmul(E const &e, F const &f);
+
+  DEFINE_FUNCTOR(pythonic::numpy, matmul);
+}
+PYTHONIC_NS_END
+
+#endif
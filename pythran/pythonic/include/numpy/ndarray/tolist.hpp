@@ -2,7 +2,7 @@
 #define PYTHONIC_INCLUDE_NUMPY_NDARRAY_TOLIST_HPP
 
 #include "pythonic/utils/functor.hpp"
-#include "pythonic/utils/numpy_conversion.hpp"
+#include "pythonic/include/utils/stream.hpp"
 #include "pythonic/types/ndarray.hpp"
 
 PYTHONIC_NS_BEGIN
@@ -22,18 +22,34 @@ namespace numpy
       using type = types::list<T>;
     };
 
+    namespace details
+    {
+      template <class T>
+      types::list<T> tolist(T const *data, long const *shape, utils::int_<1>);
+
+      template <class T, size_t N>
+      typename tolist_type<T, N>::type tolist(T const *data, long const *shape,
+                                              utils::int_<N>);
+
+      template <class E>
+      types::list<typename E::dtype> tolist(E const &expr, utils::int_<1>);
+
+      template <class E, size_t N>
+      typename tolist_type<typename E::dtype, N>::type tolist(E const &expr,
+                                                              utils::int_<N>);
+    }
+
     template <class T, class pS>
-    typename std::enable_if<std::tuple_size<pS>::value == 1,
-                            types::list<T>>::type
+    typename tolist_type<T, std::tuple_size<pS>::value>::type
     tolist(types::ndarray<T, pS> const &expr);
 
-    template <class T, class pS>
+    // rows of expressions are evaluated straight into their list
+    template <class E>
     typename std::enable_if<
-        std::tuple_size<pS>::value != 1,
-        typename tolist_type<T, std::tuple_size<pS>::value>::type>::type
-    tolist(types::ndarray<T, pS> const &expr);
+        !types::is_ndarray<E>::value && types::is_array<E>::value,
+        typename tolist_type<typename E::dtype, E::value>::type>::type
+    tolist(E const &expr);
 
-    NUMPY_EXPR_TO_NDARRAY0_DECL(tolist);
     DEFINE_FUNCTOR(pythonic::numpy::ndarray, tolist);
   }
 }
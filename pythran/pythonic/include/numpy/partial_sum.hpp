@@ -1,7 +1,9 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_PARTIAL_SUM_HPP
 #define PYTHONIC_INCLUDE_NUMPY_PARTIAL_SUM_HPP
 
+#include "pythonic/include/numpy/asarray.hpp"
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/scan.hpp"
 
 PYTHONIC_NS_BEGIN
 
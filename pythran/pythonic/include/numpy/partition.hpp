@@ -0,0 +1,24 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_PARTITION_HPP
+#define PYTHONIC_INCLUDE_NUMPY_PARTITION_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/select.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class K>
+  types::ndarray<typename E::dtype, types::array<long, E::value>>
+  partition(E const &a, K const &kth, long axis = -1);
+
+  template <class E, class K>
+  types::ndarray<typename E::dtype, types::array<long, 1>>
+  partition(E const &a, K const &kth, types::none_type);
+
+  DEFINE_FUNCTOR(pythonic::numpy, partition);
+}
+PYTHONIC_NS_END
+
+#endif
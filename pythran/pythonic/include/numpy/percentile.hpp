@@ -0,0 +1,22 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+
+#include "pythonic/include/numpy/quantile.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, types::none_type>::type
+  percentile(E const &a, Q const &q, types::none_type axis = {});
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, long>::type
+  percentile(E const &a, Q const &q, long axis);
+
+  DEFINE_FUNCTOR(pythonic::numpy, percentile);
+}
+PYTHONIC_NS_END
+
+#endif
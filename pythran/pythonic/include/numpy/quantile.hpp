@@ -0,0 +1,50 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/utils/select.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class T, long N>
+    struct quantile_array {
+      using type = types::ndarray<T, types::array<long, N>>;
+    };
+    template <class T>
+    struct quantile_array<T, 0> {
+      using type = T;
+    };
+
+    /* A scalar q reduces the input along axis, or to a scalar if there is
+     * no axis, and a sequence of quantiles adds a leading dimension.
+     */
+    template <class E, class Q, class Axis>
+    struct quantile_result {
+      static constexpr long value =
+          (std::is_same<Axis, types::none_type>::value ? 0
+                                                        : (long)E::value - 1) +
+          !std::is_arithmetic<Q>::value;
+      using dtype = decltype(std::declval<typename E::dtype>() + 1.);
+      using type = typename quantile_array<dtype, value>::type;
+    };
+  }
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, types::none_type>::type
+  quantile(E const &a, Q const &q, types::none_type axis = {});
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, long>::type
+  quantile(E const &a, Q const &q, long axis);
+
+  DEFINE_FUNCTOR(pythonic::numpy, quantile);
+}
+PYTHONIC_NS_END
+
+#endif
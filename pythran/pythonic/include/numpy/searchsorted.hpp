@@ -4,6 +4,8 @@
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/numpy_conversion.hpp"
 #include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/searchsorted.hpp"
+#include "pythonic/include/utils/stream.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/types/str.hpp"
 
@@ -1,8 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_SELECT_HPP
 #define PYTHONIC_INCLUDE_NUMPY_SELECT_HPP
 
+#include "pythonic/include/numpy/asarray.hpp"
 #include "pythonic/include/utils/functor.hpp"
-#include "pythonic/include/utils/int_.hpp"
 
 PYTHONIC_NS_BEGIN
 
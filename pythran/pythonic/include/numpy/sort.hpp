@@ -22,6 +22,19 @@ namespace numpy
   types::ndarray<typename E::dtype, types::array<long, E::value>>
   sort(E const &expr, long axis, types::str const &kind);
 
+  // temporary arrays nobody else refers to are sorted in place
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, 1>> sort(types::ndarray<T, pS> &&arr,
+                                                types::none_type);
+
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, std::tuple_size<pS>::value>>
+  sort(types::ndarray<T, pS> &&arr, long axis = -1);
+
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, std::tuple_size<pS>::value>>
+  sort(types::ndarray<T, pS> &&arr, long axis, types::str const &kind);
+
   NUMPY_EXPR_TO_NDARRAY0_DECL(sort);
   DEFINE_FUNCTOR(pythonic::numpy, sort);
 }
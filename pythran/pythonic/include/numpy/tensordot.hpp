@@ -0,0 +1,39 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_TENSORDOT_HPP
+#define PYTHONIC_INCLUDE_NUMPY_TENSORDOT_HPP
+
+#include "pythonic/include/numpy/einsum.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // Number of axes summed over, which must be known at compile time: an
+    // immediate integer, or a pair of axes or of tuples of axes.
+    template <class Axes>
+    struct tensordot_naxes {
+      using first = typename std::decay<decltype(
+          std::get<0>(std::declval<Axes const &>()))>::type;
+      static constexpr long value =
+          std::conditional<std::is_integral<first>::value,
+                           std::integral_constant<long, 1>,
+                           std::tuple_size<first>>::type::value;
+    };
+    template <long N>
+    struct tensordot_naxes<std::integral_constant<long, N>> {
+      static constexpr long value = N;
+    };
+  }
+
+  template <class A, class B, class Axes = std::integral_constant<long, 2>>
+  typename details::einsum_result<
+      A::value + B::value - 2 * details::tensordot_naxes<Axes>::value,
+      typename __combined<typename A::dtype, typename B::dtype>::type>::type
+  tensordot(A const &a, B const &b, Axes const &axes = Axes());
+
+  DEFINE_FUNCTOR(pythonic::numpy, tensordot);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -14,6 +14,12 @@ namespace numpy
     template <class E, class F, class G>
     typename __combined<F, G>::type where(E const &cond, F const &true_,
                                           G const &false_);
+#ifdef USE_XSIMD
+    template <class T, size_t N>
+    xsimd::batch<T, N> where(xsimd::batch_bool<T, N> const &cond,
+                             xsimd::batch<T, N> const &true_,
+                             xsimd::batch<T, N> const &false_);
+#endif
   }
 
 #define NUMPY_NARY_EXTRA_METHOD                                                \
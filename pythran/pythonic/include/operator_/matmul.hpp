@@ -2,7 +2,7 @@
 #define PYTHONIC_INCLUDE_OPERATOR_MATMUL_HPP
 
 #include "pythonic/include/utils/functor.hpp"
-#include "pythonic/include/numpy/dot.hpp"
+#include "pythonic/include/numpy/matmul.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -10,7 +10,8 @@ namespace operator_
 {
 
   template <class A, class B>
-  auto matmul(A const &a, B const &b) -> decltype(numpy::functor::dot{}(a, b));
+  auto matmul(A const &a, B const &b)
+      -> decltype(numpy::functor::matmul{}(a, b));
 
   DEFINE_FUNCTOR(pythonic::operator_, matmul);
 }
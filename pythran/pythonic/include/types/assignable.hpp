@@ -53,6 +53,28 @@ template <class T>
 struct assignable_noescape<T &&> : assignable_noescape<T> {
 };
 
+/* value read several times by a single statement, see types/numpy_cexpr.hpp
+ */
+template <class T>
+struct shared : assignable_noescape<T> {
+};
+
+template <class T>
+struct shared<T const> : shared<T> {
+};
+
+template <class T>
+struct shared<T const &> : shared<T> {
+};
+
+template <class T>
+struct shared<T &> : shared<T> {
+};
+
+template <class T>
+struct shared<T &&> : shared<T> {
+};
+
 template <class T>
 struct returnable : assignable<T> {
 };
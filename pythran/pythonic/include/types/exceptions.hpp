@@ -5,14 +5,109 @@
 #include "pythonic/include/types/dynamic_tuple.hpp"
 #include "pythonic/include/types/attr.hpp"
 #include "pythonic/include/builtins/str.hpp"
+#include "pythonic/include/utils/seq.hpp"
 
+#include <memory>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 
 PYTHONIC_NS_BEGIN
 
 namespace types
 {
 
+  namespace details
+  {
+    /* How an exception keeps each of its arguments until they are formatted.
+     * Scalars and strings are kept as is. Anything else may refer to storage
+     * that does not survive stack unwinding, so it is formatted right away.
+     * C strings are expected to be literals.
+     */
+    template <class T, class Enable = void>
+    struct exception_arg {
+      using type = str;
+      static str capture(T const &value)
+      {
+        return builtins::functor::str{}(value);
+      }
+    };
+    template <class T>
+    struct exception_arg<
+        T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+      using type = T;
+      static T capture(T value)
+      {
+        return value;
+      }
+    };
+    template <>
+    struct exception_arg<str> {
+      using type = str;
+      static str const &capture(str const &value)
+      {
+        return value;
+      }
+    };
+    template <>
+    struct exception_arg<char const *> {
+      using type = char const *;
+      static char const *capture(char const *value)
+      {
+        return value;
+      }
+    };
+    template <size_t N>
+    struct exception_arg<char[N]> {
+      using type = char const *;
+      static char const *capture(char const *value)
+      {
+        return value;
+      }
+    };
+  }
+
+  /* Arguments of an exception, only converted to str when first accessed.
+   * Exceptions used as control flow are thus raised and caught without
+   * building any string. Copies of an exception share their arguments.
+   */
+  class exception_args
+  {
+    struct holder_base {
+      mutable dynamic_tuple<str> values;
+      mutable bool formatted = false;
+
+      virtual ~holder_base() = default;
+      virtual dynamic_tuple<str> format() const = 0;
+    };
+
+    template <class... Types>
+    struct holder : holder_base {
+      std::tuple<Types...> captured;
+
+      template <class... Args>
+      holder(Args const &... args);
+      dynamic_tuple<str> format() const override;
+      template <size_t... Is>
+      dynamic_tuple<str> format(utils::index_sequence<Is...>) const;
+    };
+
+    std::shared_ptr<holder_base const> holder_;
+
+  public:
+    exception_args() = default;
+    template <class... Types>
+    exception_args(Types const &... types);
+
+    dynamic_tuple<str> const &get() const;
+    long size() const;
+    str const &operator[](long i) const;
+    dynamic_tuple<str>::const_iterator begin() const;
+    dynamic_tuple<str>::const_iterator end() const;
+  };
+
+  std::ostream &operator<<(std::ostream &o, exception_args const &args);
+
   class BaseException : public std::exception
   {
   public:
@@ -20,7 +115,7 @@ namespace types
     template <typename... Types>
     BaseException(Types const &... types);
     virtual ~BaseException() noexcept = default;
-    dynamic_tuple<str> args;
+    exception_args args;
   };
 
 // Use this to create a python exception class
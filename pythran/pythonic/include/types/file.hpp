@@ -11,10 +11,19 @@
 #include <fstream>
 #include <iterator>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <cstdio>
 #include <unistd.h>
 
+/* Files are read by blocks of this many bytes, lines being located within
+ * the current block. Defined as a macro so that an enlightened user can
+ * modify this variable :-)
+ */
+#ifndef PYTHRAN_FILE_BUFFER_SIZE
+#define PYTHRAN_FILE_BUFFER_SIZE 65536
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -28,7 +37,10 @@ namespace types
     file *f;
     mutable bool set;
     mutable types::str curr;
-    long position;
+    // number of lines consumed, or max() once the file is exhausted
+    mutable long position;
+
+    long peek() const;
 
   public:
     using value_type = types::str;
@@ -44,6 +56,10 @@ namespace types
 
   struct _file {
     FILE *f;
+    // read-ahead block, bytes [start, end) being read from f but not
+    // consumed yet
+    std::unique_ptr<char[]> buffer;
+    long start, end;
     _file();
     _file(types::str const &filename, types::str const &strmode = "r");
     FILE *operator*() const;
@@ -59,6 +75,11 @@ namespace types
     bool is_open;
     types::str mode, name, newlines;
 
+    // reads the next block, returns false at end of file
+    bool fill();
+    // hands the unconsumed part of the block back to f, if it can seek
+    void unread();
+
   public:
     // Types
     using iterator = file_iterator;
@@ -106,6 +127,7 @@ namespace types
     void truncate(long size = -1);
 
     long write(types::str const &str);
+    long write(char const *s, long n);
 
     template <class T>
     void writelines(T const &seq);
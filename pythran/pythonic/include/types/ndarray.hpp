@@ -38,6 +38,7 @@
 #include "pythonic/include/types/numpy_iexpr.hpp"
 #include "pythonic/include/types/numpy_gexpr.hpp"
 #include "pythonic/include/types/numpy_vexpr.hpp"
+#include "pythonic/include/types/numpy_cexpr.hpp"
 #include "pythonic/include/utils/numpy_traits.hpp"
 #include "pythonic/include/utils/array_helper.hpp"
 #include "pythonic/include/types/pointer.hpp"
@@ -266,6 +267,11 @@ namespace types
     template <class Tp, class pSp>
     ndarray(ndarray<Tp, pSp> const &other);
 
+    /* from a temporary array, whose buffer is reused if nothing else refers
+     * to it */
+    template <class pSp>
+    ndarray(ndarray<T, pSp> &&other);
+
     /* from a seed */
     ndarray(pS const &shape, none_type init);
     ndarray(pS const &shape, T init);
@@ -614,6 +620,9 @@ namespace types
     /* member functions */
     long flat_size() const;
     bool may_overlap(ndarray const &) const;
+    // whether this array is the only owner of its buffer, which it spans
+    // from the start, so that it can be reused in place of a copy
+    bool is_unique() const;
 
     template <class qS>
     ndarray<T, qS> reshape(qS const &shape) const &;
@@ -117,6 +117,8 @@ namespace types
     bool operator<(const_simd_nditerator const &other) const;
     const_simd_nditerator &operator=(const_simd_nditerator const &other);
     void store(xsimd::simd_type<typename E::dtype> const &);
+    template <class Op>
+    void update(xsimd::simd_type<typename E::dtype> const &);
   };
   template <class E>
   struct const_simd_nditerator_nostep : const_simd_nditerator<E> {
@@ -135,6 +137,36 @@ namespace types
     const_simd_nditerator_nostep &
     operator=(const_simd_nditerator_nostep const &other) = default;
   };
+
+  /* SIMD iterator over an expression whose elements are not contiguous but
+   * that can gather (resp. scatter) a vector starting at a given position
+   * through ``vload'' (resp. ``vstore'' and ``vupdate'')
+   */
+  template <class E>
+  struct const_simd_indexed_nditerator
+      : public std::iterator<std::random_access_iterator_tag,
+                             xsimd::simd_type<typename E::dtype>> {
+
+    using vector_type = typename xsimd::simd_type<typename E::dtype>;
+    E const *data;
+    long index;
+    static const std::size_t vector_size = vector_type::size;
+
+    const_simd_indexed_nditerator(E const &data, long index);
+
+    vector_type operator*() const;
+    const_simd_indexed_nditerator &operator++();
+    const_simd_indexed_nditerator &operator+=(long);
+    const_simd_indexed_nditerator operator+(long) const;
+    const_simd_indexed_nditerator &operator--();
+    long operator-(const_simd_indexed_nditerator const &other) const;
+    bool operator!=(const_simd_indexed_nditerator const &other) const;
+    bool operator==(const_simd_indexed_nditerator const &other) const;
+    bool operator<(const_simd_indexed_nditerator const &other) const;
+    void store(vector_type const &);
+    template <class Op>
+    void update(vector_type const &);
+  };
 #endif
 
   // build an iterator over T, selecting a raw pointer if possible
@@ -0,0 +1,195 @@
+#ifndef PYTHONIC_INCLUDE_TYPES_NUMPY_CEXPR_HPP
+#define PYTHONIC_INCLUDE_TYPES_NUMPY_CEXPR_HPP
+
+#include "pythonic/include/types/nditerator.hpp"
+#include "pythonic/include/types/numpy_broadcast.hpp"
+#include "pythonic/include/types/vectorizable_type.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+
+/* Number of elements of a cached expression evaluated at once.
+ * Defined as a macro so that an enlightened user can modify this variable :-)
+ */
+#ifndef PYTHRAN_CACHE_BLOCK_SIZE
+#define PYTHRAN_CACHE_BLOCK_SIZE 256
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  /* one-dimensional expression read several times by the same statement, as
+   * `x' in `x * x + x'
+   *
+   * Instead of being recomputed at each read, or evaluated as a whole into a
+   * temporary array, the expression is evaluated one block at a time into a
+   * buffer, from which all the reads falling into the block are served.
+   * Copies share the buffer, so that every operand of the statement benefits
+   * from the evaluation triggered by the first one. Expressions that
+   * broadcast, or that are read again from an earlier block, as when they are
+   * broadcast along another dimension, are evaluated as a whole, once.
+   *
+   * The buffer is not protected against concurrent reads: shared<> only
+   * selects this type when OpenMP is disabled.
+   */
+  template <class E>
+  struct numpy_cexpr {
+
+    static_assert(E::value == 1, "cached expressions are one-dimensional");
+
+    static constexpr size_t value = 1;
+    using dtype = typename E::dtype;
+    using value_type = dtype;
+    // cached values are loaded from the buffer, whatever the expression
+    static const bool is_vectorizable = types::is_vectorizable<dtype>::value;
+    static constexpr bool is_strided = false;
+    using shape_t = pshape<long>;
+
+    using iterator = const_nditerator<numpy_cexpr>;
+    using const_iterator = const_nditerator<numpy_cexpr>;
+
+    // state shared by all the copies
+    struct cache {
+      // elements [start, stop) are read from values, which points either to
+      // block or to the buffer of whole
+      long start, stop;
+      dtype const *values;
+      dtype block[PYTHRAN_CACHE_BLOCK_SIZE];
+      ndarray<dtype, pshape<long>> whole;
+      cache();
+    };
+
+    E expr_;
+    utils::shared_ref<cache> cache_;
+    long size_;
+    bool vectorize_;
+
+    numpy_cexpr();
+    numpy_cexpr(numpy_cexpr const &) = default;
+    template <class F, class = typename std::enable_if<
+                           std::is_convertible<F, E>::value>::type>
+    numpy_cexpr(F const &expr);
+
+    numpy_cexpr &operator=(numpy_cexpr const &other);
+
+    long flat_size() const;
+    long size() const;
+
+    template <size_t I>
+    long shape() const
+    {
+      return size_;
+    }
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    dtype fast(long i) const
+    {
+      // most reads fall into the current block
+      cache const &c = *cache_;
+      if (c.start <= i && i < c.stop)
+        return c.values[i - c.start];
+      return *fetch(i);
+    }
+    dtype operator[](long i) const;
+
+    // slicing, as in `(x * x + x)[1:]', evaluates the expression as a whole,
+    // once for all the copies, and views the result
+    ndarray<dtype, pshape<long>> const &whole() const;
+    template <class S>
+    typename std::enable_if<
+        is_slice<S>::value,
+        numpy_gexpr<ndarray<dtype, pshape<long>>, normalize_t<S>>>::type
+    operator[](S const &s) const
+    {
+      return ndarray<dtype, pshape<long>>(whole())[s];
+    }
+    template <class S>
+    auto operator()(S const &s) const -> decltype((*this)[s])
+    {
+      return (*this)[s];
+    }
+
+    dtype load(long i) const
+    {
+      return fast(i);
+    }
+
+#ifdef USE_XSIMD
+    using simd_iterator = const_simd_indexed_nditerator<numpy_cexpr>;
+    using simd_iterator_nobroadcast = simd_iterator;
+    template <class vectorizer>
+    simd_iterator vbegin(vectorizer) const;
+    template <class vectorizer>
+    simd_iterator vend(vectorizer) const;
+
+    xsimd::simd_type<dtype> vload(long i) const;
+#endif
+
+    // address of the i-th element, evaluating its block if needed
+    dtype const *fetch(long i) const;
+    void fill(long start) const;
+
+#ifdef USE_XSIMD
+    long vfill(long start, long n, std::false_type) const;
+    long vfill(long start, long n, std::true_type) const;
+#endif
+  };
+
+  /* a cached expression broadcast along another dimension, as `x' in
+   * `y * x + x' with a two-dimensional `y', would be read again for each row:
+   * it is evaluated as a whole instead, once for all the copies */
+  template <class E>
+  struct broadcasted<numpy_cexpr<E>>
+      : broadcasted<ndarray<typename E::dtype, pshape<long>>> {
+    broadcasted() = default;
+    broadcasted(numpy_cexpr<E> const &ref)
+        : broadcasted<ndarray<typename E::dtype, pshape<long>>>(ref.whole())
+    {
+    }
+  };
+}
+
+template <class E>
+struct assignable<types::numpy_cexpr<E>> {
+  using type = types::ndarray<typename E::dtype, types::pshape<long>>;
+};
+
+// copies share the cache, so that lazy expressions built on top of a cached
+// expression, as in a chain of fused statements, read from the same blocks
+template <class E>
+struct lazy<types::numpy_cexpr<E>> {
+  using type = types::numpy_cexpr<E>;
+};
+
+template <class E>
+struct lazy<types::numpy_cexpr<E> &> : lazy<types::numpy_cexpr<E>> {
+};
+
+template <class E>
+struct lazy<types::numpy_cexpr<E> const &> : lazy<types::numpy_cexpr<E>> {
+};
+
+/* one-dimensional expressions shared between the operands of a statement are
+ * cached, anything else is evaluated once and for all.
+ *
+ * With OpenMP, each read would have to look up the block of the calling
+ * thread, which costs more than the evaluation it saves: shared expressions
+ * are then always evaluated once and for all. */
+template <class Op, class... Args>
+struct shared<types::numpy_expr<Op, Args...>> {
+#ifdef _OPENMP
+  using type =
+      typename assignable_noescape<types::numpy_expr<Op, Args...>>::type;
+#else
+  using expr_type = typename lazy<types::numpy_expr<Op, Args...>>::type;
+  using type = typename std::conditional<
+      expr_type::value == 1, types::numpy_cexpr<expr_type>,
+      typename assignable_noescape<types::numpy_expr<Op, Args...>>::type>::
+      type;
+#endif
+};
+
+PYTHONIC_NS_END
+
+#endif
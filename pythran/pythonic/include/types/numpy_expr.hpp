@@ -590,6 +590,15 @@ namespace types
                                                     Arg::value - 1)>())...);
   }
 
+  /* Element type of the SIMD batches an argument is loaded as. This is the
+   * dtype, except for boolean expressions such as comparisons, whose batches
+   * of booleans have the layout of their operands.
+   */
+  template <class E>
+  struct vector_dtype {
+    using type = typename E::dtype;
+  };
+
   /* Expression template for numpy expressions - binary operators
    */
   template <class Op, class... Args>
@@ -598,11 +607,10 @@ namespace types
     static const bool is_vectorizable =
         utils::all_of<
             std::remove_reference<Args>::type::is_vectorizable...>::value &&
-        utils::all_of<
-            std::is_same<typename std::remove_cv<typename std::remove_reference<
-                             first_arg>::type>::type::dtype,
-                         typename std::remove_cv<typename std::remove_reference<
-                             Args>::type>::type::dtype>::value...>::value &&
+        utils::all_of<std::is_same<
+            typename vector_dtype<typename std::decay<first_arg>::type>::type,
+            typename vector_dtype<typename std::decay<Args>::type>::type>::
+                          value...>::value &&
         types::is_vector_op<
             Op, typename std::remove_reference<Args>::type::dtype...>::value;
     static const bool is_strided =
@@ -639,6 +647,14 @@ namespace types
 
     numpy_expr(Args const &... args);
 
+    // from the same expression holding its operands differently, e.g. by
+    // reference rather than by value
+    template <class... Argp,
+              class = typename std::enable_if<std::is_constructible<
+                  std::tuple<Args...>,
+                  std::tuple<Argp...> const &>::value>::type>
+    numpy_expr(numpy_expr<Op, Argp...> const &other);
+
     template <size_t... I>
     const_iterator _begin(utils::index_sequence<I...>) const;
     const_iterator begin() const;
@@ -821,6 +837,15 @@ namespace types
 
     long size() const;
   };
+
+  template <class Op, class... Args>
+  struct vector_dtype<numpy_expr<Op, Args...>> {
+    using type = typename std::conditional<
+        std::is_same<typename numpy_expr<Op, Args...>::dtype, bool>::value,
+        typename vector_dtype<typename std::decay<
+            typename utils::front<Args...>::type>::type>::type,
+        typename numpy_expr<Op, Args...>::dtype>::type;
+  };
 }
 
 template <class Op, class... Args>
@@ -2,6 +2,8 @@
 #define PYTHONIC_INCLUDE_TYPES_NUMPY_VEXPR_HPP
 
 #include "pythonic/include/types/nditerator.hpp"
+#include "pythonic/include/types/vectorizable_type.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -11,8 +13,11 @@ namespace types
   struct numpy_vexpr {
 
     static constexpr size_t value = T::value;
-    static const bool is_vectorizable = false;
     using dtype = typename dtype_of<T>::type;
+    // one-dimensional views are vectorized through gather / scatter
+    static const bool is_vectorizable =
+        value == 1 && types::is_vectorizable<dtype>::value &&
+        std::is_integral<typename dtype_of<F>::type>::value;
     using value_type = T;
     static constexpr bool is_strided = T::is_strided;
 
@@ -63,12 +68,17 @@ namespace types
     const_iterator begin() const;
     const_iterator end() const;
 #ifdef USE_XSIMD
-    using simd_iterator = const_simd_nditerator<numpy_vexpr>;
+    using simd_iterator = const_simd_indexed_nditerator<numpy_vexpr>;
     using simd_iterator_nobroadcast = simd_iterator;
     template <class vectorizer>
     simd_iterator vbegin(vectorizer) const;
     template <class vectorizer>
     simd_iterator vend(vectorizer) const;
+
+    xsimd::simd_type<dtype> vload(long i) const;
+    void vstore(long i, xsimd::simd_type<dtype> const &value);
+    template <class Op>
+    void vupdate(long i, xsimd::simd_type<dtype> const &value);
 #endif
 
     template <class... Indices>
@@ -77,12 +87,12 @@ namespace types
       return data_.load(view_.fast(i), indices...);
     }
     template <class Elt, class... Indices>
-    void store(Elt elt, long i, Indices... indices) const
+    void store(Elt elt, long i, Indices... indices)
     {
       data_.store(elt, view_.fast(i), indices...);
     }
     template <class Op, class Elt, class... Indices>
-    void update(Elt elt, long i, Indices... indices) const
+    void update(Elt elt, long i, Indices... indices)
     {
       data_.template update<Op>(elt, view_.fast(i), indices...);
     }
@@ -172,6 +182,13 @@ namespace types
   };
 }
 
+namespace utils
+{
+  template <class T, class F>
+  struct has_aliased_positions<types::numpy_vexpr<T, F>> : std::true_type {
+  };
+}
+
 template <class T, class F>
 struct assignable<types::numpy_vexpr<T, F>> {
   using type = types::ndarray<typename types::dtype_of<T>::type,
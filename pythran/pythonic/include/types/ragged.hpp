@@ -0,0 +1,174 @@
+#ifndef PYTHONIC_INCLUDE_TYPES_RAGGED_HPP
+#define PYTHONIC_INCLUDE_TYPES_RAGGED_HPP
+
+#include "pythonic/include/types/list.hpp"
+#include "pythonic/include/types/nditerator.hpp"
+#include "pythonic/include/types/slice.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/nested_container.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+
+#include <ostream>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+
+  /* list of lists whose rows are never modified
+   *
+   * The elements of every row are stored in a single buffer, and row i spans
+   * the range [offsets[i], offsets[i + 1]) of that buffer. Compared to a
+   * list of lists, this saves one allocation and one indirection per row.
+   * Rows are read through sliced lists sharing the buffer, so a ragged list
+   * can stand for a list of lists wherever it is only read.
+   */
+  template <class T>
+  class ragged
+  {
+    using container_type = container<T>;
+    utils::shared_ref<container_type> values_;
+    utils::shared_ref<std::vector<long>> offsets_;
+
+  public:
+    // types
+    using value_type = sliced_list<T, contiguous_slice>;
+    using reference = value_type;
+    using const_reference = value_type;
+    using iterator = const_nditerator<ragged>;
+    using const_iterator = const_nditerator<ragged>;
+    using size_type = long;
+
+    // minimal ndarray interface
+    using dtype = typename utils::nested_container_value_type<ragged>::type;
+    static const size_t value = utils::nested_container_depth<ragged>::value;
+    static const bool is_vectorizable = false;
+    static const bool is_strided = false;
+    using shape_t = types::array<long, value>;
+    template <size_t I>
+    auto shape() const
+        -> decltype(details::extract_shape(*this, utils::int_<I>{}))
+    {
+      return details::extract_shape(*this, utils::int_<I>{});
+    }
+
+    // constructors
+    ragged();
+    ragged(empty_list const &);
+    template <class Iterable>
+    explicit ragged(Iterable const &rows);
+
+    // construction, one row after the other
+    void reserve(long rows, long values);
+    template <class V>
+    void push_value(V &&value);
+    void end_row();
+
+    // conversion to a list of lists
+    template <class U>
+    operator list<U>() const;
+
+    // iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // size
+    long size() const;
+    explicit operator bool() const;
+
+    // accessors
+    value_type fast(long i) const;
+    value_type operator[](long i) const;
+    template <class Sp>
+    typename std::enable_if<is_slice<Sp>::value, ragged>::type
+    operator[](Sp const &s) const;
+
+    template <class... Indices>
+    dtype load(long index0, long index1, Indices... indices) const
+    {
+      return fast(index0).load(index1, indices...);
+    }
+
+    // underlying storage, used for bulk conversions
+    container_type const &values() const;
+    std::vector<long> const &offsets() const;
+
+    // comparison
+    bool operator==(ragged const &other) const;
+    template <class K>
+    bool operator==(list<K> const &other) const;
+    bool operator==(empty_list const &) const;
+    template <class K>
+    bool operator!=(K const &other) const;
+
+    // other operations
+    template <class V>
+    bool contains(V const &v) const;
+    intptr_t id() const;
+  };
+
+  template <class T>
+  std::ostream &operator<<(std::ostream &os, ragged<T> const &v);
+}
+PYTHONIC_NS_END
+
+namespace std
+{
+  template <size_t I, class T>
+  typename pythonic::types::ragged<T>::value_type
+  get(pythonic::types::ragged<T> const &t);
+
+  template <size_t I, class T>
+  struct tuple_element<I, pythonic::types::ragged<T>> {
+    typedef typename pythonic::types::ragged<T>::value_type type;
+  };
+}
+
+/* type inference stuff  {*/
+#include "pythonic/include/types/combined.hpp"
+
+template <class T0, class T1>
+struct __combined<pythonic::types::ragged<T0>, pythonic::types::list<T1>> {
+  typedef pythonic::types::list<typename __combined<
+      typename pythonic::types::ragged<T0>::value_type, T1>::type> type;
+};
+template <class T0, class T1>
+struct __combined<pythonic::types::list<T1>, pythonic::types::ragged<T0>> {
+  typedef pythonic::types::list<typename __combined<
+      typename pythonic::types::ragged<T0>::value_type, T1>::type> type;
+};
+
+template <class T>
+struct __combined<pythonic::types::ragged<T>, pythonic::types::empty_list> {
+  typedef pythonic::types::ragged<T> type;
+};
+template <class T>
+struct __combined<pythonic::types::empty_list, pythonic::types::ragged<T>> {
+  typedef pythonic::types::ragged<T> type;
+};
+
+/* } */
+
+#ifdef ENABLE_PYTHON_MODULE
+
+PYTHONIC_NS_BEGIN
+
+template <typename T>
+struct to_python<types::ragged<T>> {
+  static PyObject *convert(types::ragged<T> const &v);
+};
+
+template <class T>
+struct from_python<types::ragged<T>> {
+
+  static bool is_convertible(PyObject *obj);
+
+  static types::ragged<T> convert(PyObject *obj);
+};
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -27,6 +27,7 @@ namespace types
     raw_array(T *d, ownership o);
     raw_array(raw_array<T> &&d);
     void forget();
+    bool is_external() const;
 
     ~raw_array();
 
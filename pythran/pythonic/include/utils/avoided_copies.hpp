@@ -0,0 +1,25 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_AVOIDED_COPIES_HPP
+#define PYTHONIC_INCLUDE_UTILS_AVOIDED_COPIES_HPP
+
+/* Define this macro to count the array copies avoided by reusing the buffer
+ * of a temporary array, e.g. to check that an operation runs in place.
+ * Counting costs an atomic increment, so it is disabled by default.
+ */
+#ifdef PYTHRAN_COUNT_AVOIDED_COPIES
+#include <atomic>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  // Record that the buffer of a temporary array was reused instead of copied
+  void count_avoided_copy();
+
+  // Number of copies recorded so far, always 0 when counting is disabled
+  long avoided_copies();
+}
+PYTHONIC_NS_END
+
+#endif
@@ -48,6 +48,13 @@ namespace utils
 
 #undef SPECIALIZE_DIM_OF
 
+  /* Expressions whose distinct positions may designate the same element, as
+   * arrays indexed by an array of indices, are updated sequentially
+   */
+  template <class E>
+  struct has_aliased_positions : std::false_type {
+  };
+
   template <class E, class F, size_t N, size_t D, bool vector_form>
   E &broadcast_copy(E &self, F const &other);
 
@@ -0,0 +1,83 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_CONTRACT_HPP
+#define PYTHONIC_INCLUDE_UTILS_CONTRACT_HPP
+
+#include "pythonic/include/numpy/dot.hpp"
+
+#include <complex>
+#include <vector>
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Tensor contraction engine shared by einsum, tensordot and matmul.
+   *
+   * Operands are contiguous row-major buffers whose axes are tagged with
+   * integer labels. Contractions are carried out pairwise, each pair being
+   * laid out as a batch of matrix products so that BLAS does the heavy
+   * lifting.
+   */
+
+  /* C = op(A) . op(B) for row-major m x k and k x n operands, op being the
+   * transposition when the matching flag is set.
+   */
+  void gemm(bool transa, bool transb, long m, long n, long k, float const *A,
+            float const *B, float *C);
+  void gemm(bool transa, bool transb, long m, long n, long k, double const *A,
+            double const *B, double *C);
+  void gemm(bool transa, bool transb, long m, long n, long k,
+            std::complex<float> const *A, std::complex<float> const *B,
+            std::complex<float> *C);
+  void gemm(bool transa, bool transb, long m, long n, long k,
+            std::complex<double> const *A, std::complex<double> const *B,
+            std::complex<double> *C);
+  template <class T>
+  void gemm(bool transa, bool transb, long m, long n, long k, T const *A,
+            T const *B, T *C);
+
+  template <class T>
+  struct tensor {
+    std::vector<long> shape;
+    std::vector<int> labels;
+    std::vector<T> storage;
+    // either storage.data() or a borrowed buffer
+    T const *data;
+
+    tensor() = default;
+    tensor(tensor &&) = default;
+    tensor &operator=(tensor &&) = default;
+    tensor(tensor const &) = delete;
+
+    long size() const;
+  };
+
+  /* Extracts the diagonal of repeated labels, sums over the labels absent
+   * from `labels' and orders the remaining axes as `labels'.
+   */
+  template <class T>
+  tensor<T> reduce(tensor<T> in, std::vector<int> const &labels);
+
+  /* Contracts two operands over their common labels that are not in
+   * `keep'. The result is laid out as batch, then a-only, then b-only
+   * labels, batch labels being the common labels found in `keep'.
+   */
+  template <class T>
+  tensor<T> contract(tensor<T> a, tensor<T> b, std::vector<int> const &keep);
+
+  /* Contracts all the operands into a tensor labelled `labels', greedily
+   * picking at each step the pair that yields the smallest intermediate.
+   * `extents' maps each label to its dimension.
+   */
+  template <class T>
+  tensor<T> contract_all(std::vector<tensor<T>> operands,
+                         std::vector<int> const &labels,
+                         std::vector<long> const &extents);
+}
+PYTHONIC_NS_END
+
+#endif
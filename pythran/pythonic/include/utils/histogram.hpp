@@ -0,0 +1,77 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_HISTOGRAM_HPP
+#define PYTHONIC_INCLUDE_UTILS_HISTOGRAM_HPP
+
+#include <vector>
+
+/* Number of elements processed by a single task when binning. Defined as a
+ * macro so that an enlightened user can modify this variable :-)
+ */
+#ifndef PYTHRAN_HISTOGRAM_BLOCK_SIZE
+#define PYTHRAN_HISTOGRAM_BLOCK_SIZE 65536
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Binning engine shared by bincount, histogram, histogram2d and
+   * histogramdd. Large inputs are binned in parallel, each thread counting
+   * in its own copy of the bins, and the copies are summed at the end.
+   */
+
+  /* Minimum and maximum of [data, data + n), n > 0, in a single pass.
+   * Returns false when a NaN is met.
+   */
+  template <class T>
+  bool minmax(T const *data, long n, T &lo, T &hi);
+
+  /* Maps values to the index of their bin, or to -1 when they are out of
+   * the edges, following numpy: bins are half-open, except for the last one
+   * which includes its right edge.
+   */
+  class binner
+  {
+    std::vector<double> edges_;
+    bool uniform_;
+    double norm_;
+
+  public:
+    // nbins bins of equal width over [lo, hi]
+    binner(double lo, double hi, long nbins);
+    // explicit, monotonically increasing edges
+    template <class T>
+    binner(T const *edges, long nedges);
+
+    long size() const;
+    std::vector<double> const &edges() const;
+
+    template <class V>
+    long operator()(V const &value) const;
+  };
+
+  // [lo, hi] range of a binned dimension, from the user or from the data
+  template <class T>
+  void histogram_range(T const *data, long n, double &lo, double &hi);
+  void histogram_range(double &lo, double &hi);
+
+  struct unit_weight {
+    long operator()(long) const;
+  };
+
+  template <class T>
+  struct array_weight {
+    T const *data;
+    T operator()(long i) const;
+  };
+
+  /* Adds weight(i) to out[index(i)] for each i in [0, n) such that
+   * index(i) is non-negative. out holds nbins zero-initialized bins.
+   */
+  template <class C, class Index, class Weight>
+  void accumulate_bins(long n, long nbins, Index const &index,
+                       Weight const &weight, C *out);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_LINALG_HPP
+#define PYTHONIC_INCLUDE_UTILS_LINALG_HPP
+
+#include <complex>
+#include <memory>
+#include <type_traits>
+
+/* Matrices up to this order are factorized by simple loops, larger ones by
+ * panels of this width, updating the rest of the matrix through BLAS level 3
+ * routines. Defined as a macro so that an enlightened user can modify this
+ * variable :-)
+ */
+#ifndef PYTHRAN_LINALG_BLOCK_SIZE
+#define PYTHRAN_LINALG_BLOCK_SIZE 64
+#endif
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Dense kernels shared by numpy.linalg solve, inv, det, cholesky, lstsq
+   * and matrix_power. Matrices are row-major and contiguous. Their order is
+   * either a long or, when it is known at compile time, an
+   * std::integral_constant, in which case the loops of the small matrix
+   * kernels are fully unrolled.
+   */
+
+  // Type computations are performed in, following numpy.linalg
+  template <class T>
+  struct linalg_type {
+    using type = double;
+  };
+  template <>
+  struct linalg_type<float> {
+    using type = float;
+  };
+  template <class T>
+  struct linalg_type<std::complex<T>> {
+    using type = std::complex<
+        typename std::conditional<std::is_same<T, float>::value, float,
+                                  double>::type>;
+  };
+
+  // Order of a matrix from the type of its last dimension
+  template <class D>
+  struct matrix_order {
+    using type = long;
+    static type make(long n)
+    {
+      return n;
+    }
+  };
+  template <long N>
+  struct matrix_order<std::integral_constant<long, N>> {
+    using type = std::integral_constant<long, N>;
+    static type make(long)
+    {
+      return {};
+    }
+  };
+
+  template <class A>
+  using matrix_order_of = matrix_order<typename std::tuple_element<
+      std::decay<A>::type::value - 1,
+      typename std::decay<A>::type::shape_t>::type>;
+
+  /* Number of n x n matrices stacked in an array of the given shape, raising
+   * ValueError if they are not square.
+   */
+  template <class S>
+  long square_matrices(S const &shape, long &n);
+
+  /* Scratch area of n elements, on the stack for small matrices so that
+   * their kernels do not allocate.
+   */
+  template <class T>
+  class scratch
+  {
+    T local_[64];
+    std::unique_ptr<T[]> heap_;
+    T *data_;
+
+  public:
+    scratch(long n);
+    T *data();
+  };
+
+  /* In-place LU factorization with partial pivoting, rows i and piv[i] being
+   * swapped at step i. Returns 0, or 1 + the index of the first zero pivot,
+   * in which case the factorization is left incomplete.
+   */
+  template <class T, class N>
+  long lu_factor(T *a, N n, long *piv);
+
+  // Solves a x = b for the nrhs columns of the n x nrhs matrix b, in place
+  template <class T, class N, class R>
+  void lu_solve(T const *lu, N n, long const *piv, T *b, R nrhs);
+
+  /* In-place Cholesky factorization a = l l^H of the lower triangle of a,
+   * the upper one being zeroed. Returns 0, or 1 + the index of the first
+   * non-positive pivot.
+   */
+  template <class T, class N>
+  long cholesky_factor(T *a, N n);
+
+  /* One-sided Jacobi singular value decomposition a v = u s of the m x n
+   * matrix whose columns are w[j * m: (j + 1) * m]. On exit, these columns
+   * are those of u s, and the columns of the n x n matrix v are stored the
+   * same way.
+   */
+  template <class T>
+  void jacobi_svd(T *w, long m, long n, T *v);
+
+  // Structure of a square matrix its products can take advantage of
+  enum class matrix_structure { general, symmetric, upper, lower };
+
+  /* Triangular structure first, as a diagonal matrix is also symmetric, then
+   * symmetric structure.
+   */
+  template <class T>
+  matrix_structure structure_of(T const *a, long n);
+
+  /* c = a a for a symmetric n x n matrix a, through a rank-k update of one
+   * triangle mirrored into the other.
+   */
+  template <class T>
+  void symmetric_square(T const *a, long n, T *c);
+
+  // b = a b if left is set, b a otherwise, in place, a being triangular
+  template <class T>
+  void triangular_multiply(bool left, bool upper, T const *a, long n, T *b);
+
+  /* Calls f(i) for i in [0, count), in parallel when there is enough work,
+   * and returns the first non-zero result of f, or 0.
+   */
+  template <class F>
+  long for_each_matrix(long count, long cost, F const &f);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -16,6 +16,8 @@ namespace types
   struct array_base;
   template <class T>
   struct dynamic_tuple;
+  template <class T>
+  class ragged;
 }
 
 namespace utils
@@ -51,6 +53,11 @@ namespace utils
     static const int value = 1 + nested_container_depth<T>::value;
   };
 
+  template <class T>
+  struct nested_container_depth<types::ragged<T>> {
+    static const int value = 2 + nested_container_depth<T>::value;
+  };
+
   template <class T>
   struct nested_container_depth<types::dynamic_tuple<T>> {
     static const int value = 1 + nested_container_depth<T>::value;
@@ -110,6 +117,11 @@ namespace utils
     using type = typename nested_container_value_type<T>::type;
   };
 
+  template <class T>
+  struct nested_container_value_type<types::ragged<T>> {
+    using type = typename nested_container_value_type<T>::type;
+  };
+
   template <class T>
   struct nested_container_value_type<types::list<T>> {
     using type = typename nested_container_value_type<T>::type;
@@ -0,0 +1,72 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_NONZERO_HPP
+#define PYTHONIC_INCLUDE_UTILS_NONZERO_HPP
+
+#include <type_traits>
+#include <vector>
+
+/* Number of elements scanned by a single task when locating non-zero
+ * elements. Defined as a macro so that an enlightened user can modify this
+ * variable :-)
+ */
+#ifndef PYTHRAN_NONZERO_BLOCK_SIZE
+#define PYTHRAN_NONZERO_BLOCK_SIZE 16384
+#endif
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T, class pS>
+  struct ndarray;
+}
+
+namespace utils
+{
+
+  /* Two-pass engine shared by nonzero, argwhere, flatnonzero and mask
+   * indexing: a first pass counts the non-zero elements of each block, so that
+   * outputs are allocated with their exact size, and a second pass hands each
+   * non-zero flat index along with its rank in the output. Both passes run in
+   * parallel over blocks when OpenMP is enabled.
+   */
+
+  template <class T>
+  struct nonzero_pred {
+    T const *data;
+    bool operator()(long i) const;
+  };
+
+  struct nonzero_counts {
+    long size;
+    std::vector<long> offsets; // rank of the first non-zero of each block
+    long total() const;
+  };
+
+  template <class Pred>
+  nonzero_counts count_nonzero_blocks(Pred const &pred, long n);
+
+  template <class T>
+  nonzero_counts count_nonzero_blocks(T *data, long n);
+
+  template <class Pred, class F>
+  void for_each_nonzero(Pred const &pred, nonzero_counts const &counts, F f);
+
+  template <class T, class F>
+  void for_each_nonzero(T *data, nonzero_counts const &counts, F f);
+
+  /* Exactly-sized, malloc'ed buffer holding the indices selected by a
+   * one-dimensional boolean mask, its size is stored in `n'.
+   */
+  template <class F>
+  long *nonzero_indices(F const &filter, long &n);
+
+  template <class pS>
+  long *nonzero_indices(types::ndarray<bool, pS> const &filter, long &n);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -28,6 +28,9 @@ namespace types
   template <class O, class... Args>
   struct numpy_expr;
 
+  template <class E>
+  struct numpy_cexpr;
+
   template <class T>
   class list;
 
@@ -103,6 +106,11 @@ namespace types
     static constexpr bool value = true;
   };
 
+  template <class E>
+  struct is_array<numpy_cexpr<E>> {
+    static constexpr bool value = true;
+  };
+
   template <class T>
   struct is_numexpr_arg : is_array<T> {
   };
@@ -0,0 +1,84 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_OUTPUT_BUFFER_HPP
+#define PYTHONIC_INCLUDE_UTILS_OUTPUT_BUFFER_HPP
+
+#include <cstdio>
+#include <mutex>
+#include <streambuf>
+
+/* Formatted output is accumulated in blocks of this many bytes before being
+ * handed over to its destination. Defined as a macro so that an enlightened
+ * user can modify this variable :-)
+ */
+#ifndef PYTHRAN_OUTPUT_BUFFER_SIZE
+#define PYTHRAN_OUTPUT_BUFFER_SIZE 8192
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Block of formatted output, drained into its destination when full or
+   * synchronized. Being a stream buffer, values without a dedicated
+   * formatter can be written through their operator<<, without any
+   * intermediate string.
+   */
+  class output_buffer : public std::streambuf
+  {
+    char data_[PYTHRAN_OUTPUT_BUFFER_SIZE];
+
+  protected:
+    virtual void drain(char const *s, std::size_t n) = 0;
+
+    int overflow(int c) override;
+    std::streamsize xsputn(char const *s, std::streamsize n) override;
+    int sync() override;
+
+  public:
+    output_buffer();
+    output_buffer(output_buffer const &) = delete;
+
+    void write(char const *s, std::size_t n);
+    void put(char c);
+  };
+
+  // Output buffer of a stdio stream
+  class stdio_buffer : public output_buffer
+  {
+    FILE *f_;
+    bool interactive_;
+    std::mutex mutex_;
+
+  protected:
+    void drain(char const *s, std::size_t n) override;
+
+  public:
+    stdio_buffer(FILE *f);
+    ~stdio_buffer();
+
+    // whether the stream is a terminal, whose output is expected per line
+    bool interactive() const;
+    // serializes the writers sharing this buffer
+    std::mutex &mutex();
+    // drains the buffer and flushes the stream
+    void flush();
+  };
+
+  /* Buffer of the process standard output, shared by all threads and
+   * flushed at exit or when control goes back to Python.
+   */
+  stdio_buffer &stdout_buffer();
+
+  // Decimal representation of an integer
+  template <class I>
+  void write_integer(output_buffer &out, I value);
+
+  /* Shortest representation that reads back to the same value, laid out as
+   * Python's repr does.
+   */
+  void write_float(output_buffer &out, double value);
+  void write_float(output_buffer &out, float value);
+}
+PYTHONIC_NS_END
+
+#endif
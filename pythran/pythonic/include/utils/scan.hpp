@@ -0,0 +1,95 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SCAN_HPP
+#define PYTHONIC_INCLUDE_UTILS_SCAN_HPP
+
+#include <type_traits>
+
+/* Number of elements scanned by a single task of a parallel scan. Defined as
+ * a macro so that an enlightened user can modify this variable :-)
+ */
+#ifndef PYTHRAN_SCAN_BLOCK_SIZE
+#define PYTHRAN_SCAN_BLOCK_SIZE 65536
+#endif
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace operator_
+{
+  namespace functor
+  {
+    struct add;
+    struct iadd;
+    struct mul;
+    struct imul;
+    struct and_;
+    struct iand;
+    struct or_;
+    struct ior;
+    struct xor_;
+    struct ixor;
+  }
+}
+
+namespace numpy
+{
+  namespace functor
+  {
+    struct add;
+    struct multiply;
+    struct bitwise_and;
+    struct bitwise_or;
+    struct bitwise_xor;
+    struct logical_and;
+    struct logical_or;
+    struct maximum;
+    struct minimum;
+  }
+}
+
+namespace utils
+{
+
+  /* Scan engine shared by cumsum, cumprod and ufunc accumulation. Scans
+   * through associative operators are split in blocks: a first parallel pass
+   * reduces each block, the block totals are combined, and a second parallel
+   * pass scans each block from the combination of the previous ones.
+   * Floating point additions and products are considered associative, which
+   * only changes the rounding of the result.
+   */
+
+  template <class Op>
+  struct is_associative_op : std::false_type {
+  };
+
+  // NaN propagation of these ones depends on the order of their operands
+  template <class Op>
+  struct is_associative_int_op : std::false_type {
+  };
+
+  template <class Op, class T>
+  struct is_associative
+      : std::integral_constant<bool, is_associative_op<Op>::value ||
+                                         (std::is_integral<T>::value &&
+                                          is_associative_int_op<Op>::value)> {
+  };
+
+  /* Inclusive scan of [in, in + n) into [out, out + n), each input being
+   * cast to the output type before being combined.
+   */
+  template <class Op, class T, class A>
+  void inclusive_scan(T const *in, A *out, long n);
+
+  /* Inclusive scans along the middle axis of contiguous arrays of shape
+   * (outer, length, inner). Unless inner is one, the scans progress one
+   * slice of the middle axis at a time, vectorized along the inner axis.
+   */
+  template <class Op, class T, class A>
+  void inclusive_scan_axis(T const *in, A *out, long outer, long length,
+                           long inner);
+}
+PYTHONIC_NS_END
+
+#endif
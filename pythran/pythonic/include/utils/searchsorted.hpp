@@ -0,0 +1,102 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SEARCHSORTED_HPP
+#define PYTHONIC_INCLUDE_UTILS_SEARCHSORTED_HPP
+
+#include <vector>
+
+/* Haystacks up to this size are searched by counting, with SIMD comparisons
+ * when possible, larger ones are bisected. Defined as a macro so that an
+ * enlightened user can modify this variable :-)
+ */
+#ifndef PYTHRAN_SEARCHSORTED_LINEAR_SIZE
+#define PYTHRAN_SEARCHSORTED_LINEAR_SIZE 32
+#endif
+
+/* Haystacks from this size on are copied to a cache-friendly layout when
+ * there are more keys than elements to search in.
+ */
+#ifndef PYTHRAN_SEARCHSORTED_EYTZINGER_SIZE
+#define PYTHRAN_SEARCHSORTED_EYTZINGER_SIZE 4096
+#endif
+
+/* Number of keys processed by a single task in a batch search.
+ */
+#ifndef PYTHRAN_SEARCHSORTED_CHUNK_SIZE
+#define PYTHRAN_SEARCHSORTED_CHUNK_SIZE 1024
+#endif
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Search predicates: `before(elt, key)' holds for a prefix of the haystack,
+   * whose length is the result of the search. `ordered(prev, next)' holds
+   * when consecutive keys have non-decreasing results.
+   */
+  struct search_left {
+    template <class T, class V>
+    bool operator()(T const &elt, V const &key) const;
+    template <class V>
+    bool ordered(V const &prev, V const &next) const;
+  };
+
+  struct search_right {
+    template <class T, class V>
+    bool operator()(T const &elt, V const &key) const;
+    template <class V>
+    bool ordered(V const &prev, V const &next) const;
+  };
+
+  // left search in a haystack sorted in decreasing order
+  struct search_left_decreasing {
+    template <class T, class V>
+    bool operator()(T const &elt, V const &key) const;
+    template <class V>
+    bool ordered(V const &prev, V const &next) const;
+  };
+
+  /* Searches keys in the sorted, contiguous haystack [data, data + size),
+   * choosing the strategy from the haystack size and the expected number
+   * of keys.
+   */
+  template <class Before, class T>
+  class sorted_searcher
+  {
+    Before before;
+    T const *data;
+    long size;
+    std::vector<T> tree;    // haystack in Eytzinger (breadth-first) order
+    std::vector<long> rank; // position in the haystack of each tree node
+
+    long _build(long k, long i);
+    template <class V>
+    long _search(V const &key) const;
+    template <class V>
+    long _gallop(long from, V const &key) const;
+
+  public:
+    sorted_searcher(Before before, T const *data, long size, long nkeys);
+
+    template <class V>
+    long operator()(V const &key) const;
+
+    // sequential search of [keys, keys + nkeys)
+    template <class V>
+    void operator()(V const *keys, long nkeys, long *out) const;
+  };
+
+  template <class Before, class T, class V>
+  long search_sorted(Before before, T const *data, long size, V const &key);
+
+  // parallel search of [keys, keys + nkeys)
+  template <class Before, class T, class V>
+  void search_sorted(Before before, T const *data, long size, V const *keys,
+                     long nkeys, long *out);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SELECT_HPP
+#define PYTHONIC_INCLUDE_UTILS_SELECT_HPP
+
+#include <complex>
+
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Selection engine shared by median, quantile, percentile, their NaN-aware
+   * variants, partition and argpartition. Several positions are selected in
+   * a single pass: each selection splits the range around its pivot, and the
+   * remaining positions are only searched for in the relevant side.
+   */
+
+  // Ordering of numpy.sort: lexicographic for complex numbers
+  struct select_less {
+    template <class T>
+    bool operator()(T const &a, T const &b) const;
+    template <class T>
+    bool operator()(std::complex<T> const &a, std::complex<T> const &b) const;
+  };
+
+  struct identity_key {
+    template <class T>
+    T const &operator()(T const &value) const;
+  };
+
+  /* Partially sorts [first, last) so that for each k of the sorted range
+   * [kfirst, klast), first[k] is the element a full sort would put there,
+   * no greater element being before it and no smaller one after it. NaNs,
+   * as seen through key, are moved at the end of the range.
+   */
+  template <class It, class K, class Key = identity_key>
+  void select(It first, It last, K kfirst, K klast, Key key = Key());
+
+  /* Linear interpolation of the quantiles qs[order[0]] <= qs[order[1]] <= ...
+   * of [first, first + n), stored in out[order[i] * stride]. The range is
+   * partially sorted in the process. NaNs are ignored if skipnan is set, and
+   * turn every quantile into a NaN otherwise.
+   */
+  template <class T, class D>
+  void quantiles(T *first, long n, double const *qs, long const *order,
+                 long nq, bool skipnan, D *out, long stride);
+
+  /* Splits a row-major shape into (outer, shape[axis], inner), so that the
+   * lanes along axis start at o * n * inner + i and have a stride of inner.
+   */
+  template <class S>
+  void split_lanes(S const &shape, long axis, long &outer, long &n,
+                   long &inner);
+
+  /* Calls f(lane, offset, buffer) for each of the outer * inner lanes, in
+   * parallel for large arrays. buffer is a per-thread scratch area of n
+   * elements of type B.
+   */
+  template <class B, class F>
+  void for_each_lane(long outer, long n, long inner, F const &f);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -95,6 +95,10 @@ namespace utils
     extern_type get_foreign();
     bool is_foreign() const;
 
+    // Whether this is the only reference to memory owned by pythran, so
+    // that it can be modified without anyone noticing
+    bool unique() const noexcept;
+
   private:
     void dispose();
     void acquire();
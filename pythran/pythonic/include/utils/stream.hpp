@@ -0,0 +1,59 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_STREAM_HPP
+#define PYTHONIC_INCLUDE_UTILS_STREAM_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/vectorizable_type.hpp"
+#include "pythonic/include/utils/int_.hpp"
+
+/* Number of elements of an expression evaluated at once when it is
+ * streamed. Defined as a macro so that an enlightened user can modify this
+ * variable :-)
+ */
+#ifndef PYTHRAN_STREAM_BLOCK_SIZE
+#define PYTHRAN_STREAM_BLOCK_SIZE 1024
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Chunked evaluation of an array expression, for consumers that read its
+   * elements once and in order: f(block, n) is called on consecutive
+   * blocks of its flattened elements, so that the expression is never
+   * evaluated as a whole.
+   *
+   * Expression blocks hold at most PYTHRAN_STREAM_BLOCK_SIZE elements,
+   * evaluated in a local buffer. An ndarray is passed as a single block,
+   * straight from its buffer.
+   */
+  template <class E, class F>
+  void stream_blocks(E const &expr, F &&f);
+
+  template <class T, class pS, class F>
+  void stream_blocks(types::ndarray<T, pS> const &expr, F &&f);
+
+  namespace details
+  {
+    template <class T, class F>
+    class block_stream
+    {
+      T block_[PYTHRAN_STREAM_BLOCK_SIZE];
+      long size_;
+      F &f_;
+
+    public:
+      block_stream(F &f);
+
+      template <class E>
+      void feed(E const &expr, utils::int_<1>);
+      template <class E, size_t N>
+      void feed(E const &expr, utils::int_<N>);
+
+      void flush();
+    };
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -17,6 +17,8 @@ public:
   bool operator==(yielder const &other) const;
 
   long __generator_state;
+  // set when the value of the last step has not been consumed by next()
+  bool __generator_pending;
 };
 PYTHONIC_NS_END
 
@@ -0,0 +1,58 @@
+#ifndef PYTHONIC_NUMPY_ARGPARTITION_HPP
+#define PYTHONIC_NUMPY_ARGPARTITION_HPP
+
+#include "pythonic/include/numpy/argpartition.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/partition.hpp"
+#include "pythonic/builtins/None.hpp"
+
+#include <numeric>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class K>
+  types::ndarray<long, types::array<long, E::value>>
+  argpartition(E const &a, K const &kth, long axis)
+  {
+    using T = typename E::dtype;
+    auto const &arr = asarray(a);
+    axis = details::partition_axis<E::value>(axis);
+    auto shape = sutils::getshape(arr);
+    long outer, n, inner;
+    utils::split_lanes(shape, axis, outer, n, inner);
+    std::vector<long> ks = details::partition_kth(kth, n);
+
+    types::ndarray<long, types::array<long, E::value>> out(shape,
+                                                           builtins::None);
+    T const *data = arr.buffer;
+    long *indices = out.buffer;
+    utils::for_each_lane<long>(
+        outer, n, inner, [&](long, long offset, long *buffer) {
+          // the indices are partitioned in place for contiguous lanes
+          long *lane = inner == 1 ? indices + offset : buffer;
+          T const *values = data + offset;
+          std::iota(lane, lane + n, 0L);
+          utils::select(lane, lane + n, ks.begin(), ks.end(),
+                        [values, inner](long i) { return values[i * inner]; });
+          if (inner != 1)
+            for (long j = 0; j < n; ++j)
+              indices[offset + j * inner] = lane[j];
+        });
+    return out;
+  }
+
+  template <class E, class K>
+  types::ndarray<long, types::array<long, 1>>
+  argpartition(E const &a, K const &kth, types::none_type)
+  {
+    return argpartition(asarray(a).flat(), kth, 0L);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -4,6 +4,7 @@
 #include "pythonic/include/numpy/argwhere.hpp"
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/nonzero.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
 
@@ -15,30 +16,23 @@ namespace numpy
   typename types::ndarray<long, types::array<long, 2>> argwhere(E const &expr)
   {
     constexpr long N = E::value;
-    auto arr = asarray(expr);
-    long sz = arr.flat_size();
+    auto const &arr = asarray(expr);
     auto eshape = sutils::getshape(arr);
+    auto counts = utils::count_nonzero_blocks(arr.buffer, arr.flat_size());
 
-    utils::shared_ref<types::raw_array<long>> buffer(sz *
-                                                     N); // too much memory used
-    long *buffer_iter = buffer->data;
-
-    long real_sz = 0;
-    auto iter = arr.fbegin();
-    for (long i = 0; i < sz; ++i, ++iter) {
-      if (*iter) {
-        ++real_sz;
-        long mult = 1;
-        for (long j = N - 1; j > 0; j--) {
-          buffer_iter[j] = (i / mult) % eshape[j];
-          mult *= eshape[j];
-        }
-        buffer_iter[0] = i / mult;
-        buffer_iter += N;
+    types::array<long, 2> shape = {counts.total(), N};
+    types::ndarray<long, types::array<long, 2>> out(shape,
+                                                    types::none_type{});
+    long *buffer = out.buffer;
+    utils::for_each_nonzero(arr.buffer, counts, [=](long pos, long i) {
+      long *row = buffer + pos * N;
+      for (long j = N - 1; j > 0; --j) {
+        row[j] = i % eshape[j];
+        i /= eshape[j];
       }
-    }
-    types::array<long, 2> shape = {real_sz, N};
-    return {buffer, shape};
+      row[0] = i;
+    });
+    return out;
   }
 }
 PYTHONIC_NS_END
@@ -3,14 +3,41 @@
 
 #include "pythonic/include/numpy/array.hpp"
 
+#include "pythonic/utils/avoided_copies.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/nested_container.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/ragged.hpp"
+#include "pythonic/builtins/ValueError.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class A, class I, class T>
+    A make_array(I &&iterable, T const *)
+    {
+      return {std::forward<I>(iterable)};
+    }
+
+    template <class A, class I, class T>
+    A make_array(I &&rows, types::ragged<T> const *)
+    {
+      auto const &offsets = rows.offsets();
+      long n = rows.size();
+      long m = n ? offsets[1] : 0;
+      for (long i = 1; i < n; ++i)
+        if (offsets[i + 1] - offsets[i] != m)
+          throw types::ValueError(
+              "setting an array element with a sequence.");
+      A out(types::array<long, 2>{{n, m}}, builtins::None);
+      std::copy(rows.values().begin(), rows.values().end(), out.buffer);
+      return out;
+    }
+  }
+
   template <class T, class dtype>
   typename std::enable_if<
       types::has_size<typename std::decay<T>::type>::value,
@@ -18,7 +45,10 @@ namespace numpy
                      types::array<long, std::decay<T>::type::value>>>::type
   array(T &&iterable, dtype d)
   {
-    return {std::forward<T>(iterable)};
+    using decayed = typename std::decay<T>::type;
+    return details::make_array<types::ndarray<
+        typename dtype::type, types::array<long, decayed::value>>>(
+        std::forward<T>(iterable), static_cast<decayed const *>(nullptr));
   }
   template <class T, class dtype>
   typename std::enable_if<
@@ -58,6 +88,15 @@ namespace numpy
     return arr.copy();
   }
 
+  template <class T, class pS>
+  types::ndarray<T, pS> array(types::ndarray<T, pS> &&arr)
+  {
+    if (!arr.is_unique())
+      return arr.copy();
+    utils::count_avoided_copy();
+    return std::move(arr);
+  }
+
   template <class T, size_t N, class V, class dtype>
   types::ndarray<typename dtype::type,
                  typename types::array_base<T, N, V>::shape_t>
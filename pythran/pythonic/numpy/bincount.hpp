@@ -3,27 +3,83 @@
 
 #include "pythonic/include/numpy/bincount.hpp"
 
-#include "pythonic/numpy/max.hpp"
-#include "pythonic/utils/numpy_conversion.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/histogram.hpp"
+#include "pythonic/utils/stream.hpp"
+
+#include <algorithm>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    long bincount_minlength(types::none<long> minlength)
+    {
+      long length = minlength ? (long)minlength : 0L;
+      if (length < 0)
+        throw types::ValueError("'minlength' must not be negative");
+      return length;
+    }
+
+    template <class T>
+    void bincount_check(T lo)
+    {
+      if (lo < 0)
+        throw types::ValueError("'list' argument must have no negative "
+                                "elements");
+    }
+
+    // Number of bins needed to count the n values of data.
+    template <class T>
+    long bincount_length(T const *data, long n, types::none<long> minlength)
+    {
+      long length = bincount_minlength(minlength);
+      if (n == 0)
+        return length;
+      T lo, hi;
+      utils::minmax(data, n, lo, hi);
+      bincount_check(lo);
+      return std::max<long>(length, 1 + (long)hi);
+    }
+
+    // Same as above, the bounds of expr being found one block at a time.
+    template <class E>
+    long bincount_length(E const &expr, types::none<long> minlength)
+    {
+      using T = typename E::dtype;
+      long length = bincount_minlength(minlength);
+      bool empty = true;
+      T lo = T(), hi = T();
+      utils::stream_blocks(expr, [&](T const *data, long n) {
+        T blo, bhi;
+        utils::minmax(data, n, blo, bhi);
+        lo = empty ? blo : std::min(lo, blo);
+        hi = empty ? bhi : std::max(hi, bhi);
+        empty = false;
+      });
+      if (empty)
+        return length;
+      bincount_check(lo);
+      return std::max<long>(length, 1 + (long)hi);
+    }
+  }
+
   template <class T, class pS>
   typename std::enable_if<std::tuple_size<pS>::value == 1,
                           types::ndarray<long, types::pshape<long>>>::type
-  bincount(types::ndarray<T, pS> const &expr, types::none_type weights,
+  bincount(types::ndarray<T, pS> const &expr, types::none_type,
            types::none<long> minlength)
   {
-    long length = 0;
-    if (minlength)
-      length = (long)minlength;
-    length = std::max<long>(length, 1 + max(expr));
+    T const *data = expr.buffer;
+    long n = expr.flat_size();
+    long length = details::bincount_length(data, n, minlength);
     types::ndarray<long, types::pshape<long>> out(types::pshape<long>(length),
                                                   0L);
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end; ++iter)
-      ++out[*iter];
+    utils::accumulate_bins(n, length, [data](long i) { return (long)data[i]; },
+                           utils::unit_weight{}, out.buffer);
     return out;
   }
 
@@ -36,24 +92,53 @@ namespace numpy
   bincount(types::ndarray<T, pS> const &expr, E const &weights,
            types::none<long> minlength)
   {
-    long length = 0;
-    if (minlength)
-      length = (long)minlength;
-    length = std::max<long>(length, 1 + max(expr));
-    typename std::enable_if<
-        std::tuple_size<pS>::value == 1,
-        types::ndarray<decltype(std::declval<long>() *
-                                std::declval<typename E::dtype>()),
-                       types::pshape<long>>>::type
-    out(types::pshape<long>(length), 0L);
-    auto iweight = weights.fbegin();
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end;
-         ++iter, ++iweight)
-      out[*iter] += *iweight;
+    using weight_type = decltype(std::declval<long>() *
+                                 std::declval<typename E::dtype>());
+    T const *data = expr.buffer;
+    long n = expr.flat_size();
+    auto const &w = asarray(weights);
+    if (w.flat_size() != n)
+      throw types::ValueError("The weights and list don't have the same "
+                              "length.");
+    long length = details::bincount_length(data, n, minlength);
+    types::ndarray<weight_type, types::pshape<long>> out(
+        types::pshape<long>(length), weight_type(0));
+    utils::accumulate_bins(
+        n, length, [data](long i) { return (long)data[i]; },
+        utils::array_weight<typename std::decay<decltype(w)>::type::dtype>{
+            w.buffer}, out.buffer);
     return out;
   }
 
-  NUMPY_EXPR_TO_NDARRAY0_IMPL(bincount);
+  template <class E>
+  typename std::enable_if<!types::is_ndarray<E>::value &&
+                              types::is_array<E>::value && E::value == 1,
+                          types::ndarray<long, types::pshape<long>>>::type
+  bincount(E const &expr, types::none_type, types::none<long> minlength)
+  {
+    // the bounds are streamed, the values being evaluated again when counted
+    // rather than stored in a temporary array
+    long n = expr.flat_size();
+    long length = details::bincount_length(expr, minlength);
+    types::ndarray<long, types::pshape<long>> out(types::pshape<long>(length),
+                                                  0L);
+    utils::accumulate_bins(n, length,
+                           [&expr](long i) { return (long)expr.fast(i); },
+                           utils::unit_weight{}, out.buffer);
+    return out;
+  }
+
+  template <class E, class W>
+  typename std::enable_if<
+      !types::is_ndarray<E>::value && types::is_array<E>::value &&
+          E::value == 1,
+      types::ndarray<decltype(std::declval<long>() *
+                              std::declval<typename W::dtype>()),
+                     types::pshape<long>>>::type
+  bincount(E const &expr, W const &weights, types::none<long> minlength)
+  {
+    return bincount(asarray(expr), weights, minlength);
+  }
 }
 PYTHONIC_NS_END
 
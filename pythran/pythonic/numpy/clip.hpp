@@ -31,6 +31,27 @@ namespace numpy
       else
         return v;
     }
+
+#ifdef USE_XSIMD
+    /* Same semantic as the scalar versions, NaN included, through masks
+     * instead of branches.
+     */
+    template <class T, size_t N>
+    xsimd::batch<T, N> clip(xsimd::batch<T, N> const &v,
+                            xsimd::batch<T, N> const &a_min,
+                            xsimd::batch<T, N> const &a_max)
+    {
+      return xsimd::select(v < a_min, a_min,
+                           xsimd::select(v > a_max, a_max, v));
+    }
+
+    template <class T, size_t N>
+    xsimd::batch<T, N> clip(xsimd::batch<T, N> const &v,
+                            xsimd::batch<T, N> const &a_min)
+    {
+      return xsimd::select(v < a_min, a_min, v);
+    }
+#endif
   }
 
 #define NUMPY_NARY_FUNC_NAME clip
@@ -3,10 +3,12 @@
 
 #include "pythonic/include/numpy/convolve.hpp"
 #include "pythonic/numpy/correlate.hpp"
-#include "pythonic/numpy/flip.hpp"
-#include "pythonic/numpy/conjugate.hpp"
+#include "pythonic/numpy/asarray.hpp"
 #include "pythonic/types/ndarray.hpp"
 
+#include <algorithm>
+#include <vector>
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
@@ -16,18 +18,39 @@ namespace numpy
   types::ndarray<typename A::dtype, types::pshape<long>>
   convolve(A const &inA, B const &inB, U type)
   {
-    auto inB_flipped = functor::flip{}(inB, 0);
-    auto inB_flip_conj = functor::conjugate{}(inB_flipped);
-    return functor::correlate{}(inA, inB_flip_conj, type);
+    using out_type =
+        typename __combined<typename A::dtype, typename B::dtype>::type;
+    auto const &a = functor::asarray{}(inA);
+    auto const &v = functor::asarray{}(inB);
+    long NA = a.template shape<0>();
+    long NV = v.template shape<0>();
+
+    // Convolution is symmetric: the shortest input is reversed once and
+    // slides over the other one.
+    std::vector<out_type> xs, ws;
+    out_type const *x;
+    if (NA < NV) {
+      x = details::as_contiguous(v, false, xs);
+      ws.assign(a.buffer, a.buffer + NA);
+    } else {
+      x = details::as_contiguous(a, false, xs);
+      ws.assign(v.buffer, v.buffer + NV);
+    }
+    std::reverse(ws.begin(), ws.end());
+    long nx = std::max(NA, NV), nw = ws.size();
+
+    long left, outN;
+    details::correlate_bounds(type, nx, nw, left, outN);
+    types::ndarray<out_type, types::pshape<long>> out{outN, builtins::None};
+    details::correlate_kernel(x, nx, ws.data(), nw, left, out.buffer, outN);
+    return out;
   }
 
   template <class A, class B>
   types::ndarray<typename A::dtype, types::pshape<long>> convolve(A const &inA,
                                                                   B const &inB)
   {
-    auto inB_flipped = functor::flip{}(inB, 0);
-    auto inB_flip_conj = functor::conjugate{}(inB_flipped);
-    return functor::correlate{}(inA, inB_flip_conj, "full");
+    return convolve(inA, inB, "full");
   }
 
   NUMPY_EXPR_TO_NDARRAY0_IMPL(convolve)
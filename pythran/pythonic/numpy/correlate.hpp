@@ -2,114 +2,293 @@
 #define PYTHONIC_NUMPY_CORRELATE_HPP
 
 #include "pythonic/include/numpy/correlate.hpp"
-#include "pythonic/numpy/dot.hpp"
 #include "pythonic/numpy/conjugate.hpp"
 #include "pythonic/numpy/asarray.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+
+#include "pythonic/numpy/fft/pocketfft.hpp"
+
+#include <algorithm>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-
-  template <class A, class B, typename U>
-  types::ndarray<typename A::dtype, types::pshape<long>>
-  do_correlate(A const &inA, B const &inB, U type, int out_inc)
-  // out_inc is used to indicate the inputs were swapped, which means that the
-  // output must be time reversed and conjugated
+  namespace details
   {
-    auto shapeA = sutils::getshape(inA);
-    auto shapeB = sutils::getshape(inB);
+    /* All the kernels below compute
+     *
+     *   out[j] = sum_k x[left + j + k] * w[k]    for 0 <= j < n
+     *
+     * where x is considered null outside of [0, nx). Correlation and
+     * convolution only differ in how x and w are built from their inputs.
+     */
 
-    long NA = shapeA[0];
-    long NB = shapeB[0];
+    // Outputs for which the window only partially overlaps x.
+    template <class T>
+    void correlate_edge(T const *x, long nx, T const *w, long nw, long left,
+                        T *out, long n)
+    {
+      for (long j = 0; j < n; ++j) {
+        long s = left + j;
+        long kbeg = std::max(0L, -s), kend = std::min(nw, nx - s);
+        T acc = T();
+        for (long k = kbeg; k < kend; ++k)
+          acc += x[s + k] * w[k];
+        out[j] = acc;
+      }
+    }
 
-    using out_type =
-        typename __combined<typename A::dtype, typename B::dtype>::type;
-    // At this point, handling views would slow things down tremendously
-    auto inA_ = functor::asarray{}(inA);
-    auto inB_ = functor::asarray{}(inB);
-
-    auto outN = 0;
-    int iLeft, iRight;
-    if (type == "full") {
-      outN = NA + NB - 1;
-      iLeft = -NB + 1;
-    } else if (type == "valid") {
-      outN = NA - NB + 1;
-      iLeft = 0;
-    } else if (type == "same") {
-      outN = NA;
-      iLeft = -NB + 1 + (NB - 1) / 2;
+    // Outputs for which the window fully overlaps x: a block of outputs is
+    // accumulated tap after tap, which keeps the accumulators in registers,
+    // vectorizes along the outputs and preserves the summation order of the
+    // naive loop.
+    template <class T>
+    void correlate_direct(T const *x, T const *w, long nw, T *out, long n)
+    {
+      constexpr long B = PYTHRAN_CORRELATE_BLOCK_SIZE;
+      long nblocks = (n + B - 1) / B;
+#ifdef _OPENMP
+#pragma omp parallel for if (n * nw >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT *   \
+                                          PYTHRAN_CORRELATE_BLOCK_SIZE)
+#endif
+      for (long b = 0; b < nblocks; ++b) {
+        long j0 = b * B;
+        if (j0 + B <= n) {
+          T acc[B] = {};
+          for (long k = 0; k < nw; ++k) {
+            T wk = w[k];
+            T const *xk = x + j0 + k;
+            for (long j = 0; j < B; ++j)
+              acc[j] += xk[j] * wk;
+          }
+          std::copy(acc, acc + B, out + j0);
+        } else {
+          for (long j = j0; j < n; ++j) {
+            T acc = T();
+            for (long k = 0; k < nw; ++k)
+              acc += x[j + k] * w[k];
+            out[j] = acc;
+          }
+        }
+      }
     }
-    // We need outN output values, no matter what.
-    iRight = iLeft + outN;
-
-    // Allocate output array
-    types::ndarray<out_type, types::pshape<long>> out = {outN, out_type()};
-    out_type *out_ptr = (out_type *)out.buffer;
-    // if out_inc is -1, we reverse the output.
-    if (out_inc == -1)
-      out_ptr += outN - 1;
-
-    // For small correlations, numpy uses small_correlate, far more efficient.
-    // see numpy/core/src/multiarray/arraytypes.c.src
-
-    if (out_inc == 1) {
-      // Incomplete overlap left
-      for (int i = iLeft; i < 0; i++, out_ptr++) {
-        *out_ptr = numpy::dot(inA_(types::contiguous_slice(0, NB + i)),
-                              inB_(types::contiguous_slice(-i, NB)));
+
+    template <class T>
+    struct is_fft_type : std::is_floating_point<T> {
+    };
+    template <class T>
+    struct is_fft_type<std::complex<T>> : std::is_floating_point<T> {
+    };
+
+    // Single precision transforms are carried out in double precision, so
+    // that their rounding errors do not show in the result.
+    template <class T>
+    struct fft_type {
+      using type = typename std::conditional<std::is_same<T, float>::value,
+                                             double, T>::type;
+    };
+    template <class T>
+    struct fft_type<std::complex<T>> {
+      using type = std::complex<typename fft_type<T>::type>;
+    };
+
+    // Spectrum products, in the half-complex layout of pocketfft's real
+    // transforms and in the plain layout of its complex transforms.
+    template <class T>
+    void spectrum_mul(T *c, T const *h, long L)
+    {
+      c[0] *= h[0];
+      long i = 1;
+      for (; i + 1 < L; i += 2) {
+        T re = c[i] * h[i] - c[i + 1] * h[i + 1];
+        T im = c[i] * h[i + 1] + c[i + 1] * h[i];
+        c[i] = re;
+        c[i + 1] = im;
       }
-      // Complete overlap middle
-      for (int i = 0; i <= NA - NB; i++, out_ptr++) {
-        *out_ptr = numpy::dot(inA_(types::contiguous_slice(i, i + NB)),
-                              inB_(types::contiguous_slice(0, NB)));
+      if (i < L)
+        c[i] *= h[i];
+    }
+    template <class T>
+    void spectrum_mul(std::complex<T> *c, std::complex<T> const *h, long L)
+    {
+      for (long i = 0; i < L; ++i)
+        c[i] *= h[i];
+    }
+
+    template <class T>
+    struct fft_plan {
+      pocketfft::detail::pocketfft_r<T> plan;
+      fft_plan(long L) : plan(L)
+      {
       }
-      // Incomplete overlap right.
-      for (int i = NA - NB + 1; i < iRight; i++, out_ptr++) {
-        *out_ptr = numpy::dot(inA_(types::contiguous_slice(i, NA)),
-                              inB_(types::contiguous_slice(0, NA - i)));
+      void operator()(T *c, T fct, bool forward) const
+      {
+        plan.exec(c, fct, forward);
       }
-    } else {
-      // Incomplete overlap left
-      for (int i = iLeft; i < 0; i++, out_ptr += out_inc) {
-        *out_ptr = wrapper::conjugate(
-            numpy::dot(inA_(types::contiguous_slice(0, NB + i)),
-                       inB_(types::contiguous_slice(-i, NB))));
+    };
+    template <class T>
+    struct fft_plan<std::complex<T>> {
+      pocketfft::detail::pocketfft_c<T> plan;
+      fft_plan(long L) : plan(L)
+      {
       }
-      // Complete overlap middle
-      for (int i = 0; i <= NA - NB; i++, out_ptr += out_inc) {
-        *out_ptr = wrapper::conjugate(
-            numpy::dot(inA_(types::contiguous_slice(i, i + NB)),
-                       inB_(types::contiguous_slice(0, NB))));
+      void operator()(std::complex<T> *c, T fct, bool forward) const
+      {
+        plan.exec(reinterpret_cast<pocketfft::detail::cmplx<T> *>(c), fct,
+                  forward);
       }
-      // Incomplete overlap right.
-      for (int i = NA - NB + 1; i < iRight; i++, out_ptr += out_inc) {
-        *out_ptr = wrapper::conjugate(
-            numpy::dot(inA_(types::contiguous_slice(i, NA)),
-                       inB_(types::contiguous_slice(0, NA - i))));
+    };
+
+    // Overlap-save: each segment of L samples of x yields L - nw + 1
+    // outputs of its circular convolution with the reversed window. Reads
+    // outside of x are zero-padded, so partial overlaps need no special care.
+    template <class T>
+    void correlate_fft(T const *x, long nx, T const *w, long nw, long left,
+                       T *out, long n)
+    {
+      using F = typename fft_type<T>::type;
+      using real_type = decltype(std::abs(std::declval<F>()));
+      long L = pocketfft::detail::util::good_size_cmplx(
+          nw - 1 + std::min(n, 3 * nw));
+      long M = L - nw + 1;
+      fft_plan<F> plan(L);
+
+      std::vector<F> h(L, F());
+      std::reverse_copy(w, w + nw, h.begin());
+      plan(h.data(), real_type(1), true);
+
+      long nblocks = (n + M - 1) / M;
+#ifdef _OPENMP
+#pragma omp parallel for if (nblocks > 1)
+#endif
+      for (long b = 0; b < nblocks; ++b) {
+        std::vector<F> seg(L);
+        long j0 = b * M, s0 = left + j0;
+        for (long i = 0; i < L; ++i)
+          seg[i] = (s0 + i >= 0 && s0 + i < nx) ? F(x[s0 + i]) : F();
+        plan(seg.data(), real_type(1), true);
+        spectrum_mul(seg.data(), h.data(), L);
+        plan(seg.data(), real_type(1) / L, false);
+        std::transform(seg.begin() + (nw - 1),
+                       seg.begin() + (nw - 1) + std::min(M, n - j0), out + j0,
+                       [](F const &v) { return static_cast<T>(v); });
       }
     }
 
-    return out;
+    template <class T>
+    typename std::enable_if<is_fft_type<T>::value, bool>::type
+    correlate_fft_dispatch(T const *x, long nx, T const *w, long nw, long left,
+                           T *out, long n)
+    {
+      if (nw < PYTHRAN_CORRELATE_FFT_SIZE || n < PYTHRAN_CORRELATE_FFT_SIZE)
+        return false;
+      correlate_fft(x, nx, w, nw, left, out, n);
+      return true;
+    }
+    template <class T>
+    typename std::enable_if<!is_fft_type<T>::value, bool>::type
+    correlate_fft_dispatch(T const *, long, T const *, long, long, T *, long)
+    {
+      return false;
+    }
+
+    template <class T>
+    void correlate_kernel(T const *x, long nx, T const *w, long nw, long left,
+                          T *out, long n)
+    {
+      if (correlate_fft_dispatch(x, nx, w, nw, left, out, n))
+        return;
+      // [j0, j1) is the range of outputs with a full overlap
+      long j0 = std::min(std::max(-left, 0L), n);
+      long j1 = std::min(std::max(nx - nw + 1 - left, j0), n);
+      correlate_edge(x, nx, w, nw, left, out, j0);
+      if (j0 < j1)
+        correlate_direct(x + left + j0, w, nw, out + j0, j1 - j0);
+      correlate_edge(x, nx, w, nw, left + j1, out + j1, n - j1);
+    }
+
+    // Offset of the first output and number of outputs for each mode, nx
+    // being the length of the longest input, nw the length of the other one.
+    void correlate_bounds(types::str const &mode, long nx, long nw,
+                          long &left, long &n)
+    {
+      if (mode == "full") {
+        left = 1 - nw;
+        n = nx + nw - 1;
+      } else if (mode == "valid") {
+        left = 0;
+        n = nx - nw + 1;
+      } else if (mode == "same") {
+        left = -(nw / 2);
+        n = nx;
+      } else
+        throw types::ValueError("mode must be one of 'valid', 'same', or "
+                                "'full'");
+    }
+
+    // Contiguous view of `in' with dtype T, conjugated if requested. The
+    // input buffer is used as is when no conversion is needed.
+    template <class T, class E>
+    typename std::enable_if<std::is_same<T, typename E::dtype>::value,
+                            T const *>::type
+    as_contiguous(E const &in, bool conj, std::vector<T> &storage)
+    {
+      if (!conj || !types::is_complex<T>::value)
+        return in.buffer;
+      long size = in.template shape<0>();
+      storage.resize(size);
+      for (long i = 0; i < size; ++i)
+        storage[i] = wrapper::conjugate(in.buffer[i]);
+      return storage.data();
+    }
+    template <class T, class E>
+    typename std::enable_if<!std::is_same<T, typename E::dtype>::value,
+                            T const *>::type
+    as_contiguous(E const &in, bool conj, std::vector<T> &storage)
+    {
+      long size = in.template shape<0>();
+      storage.resize(size);
+      for (long i = 0; i < size; ++i)
+        storage[i] = conj ? static_cast<T>(wrapper::conjugate(in.buffer[i]))
+                          : static_cast<T>(in.buffer[i]);
+      return storage.data();
+    }
   }
 
   template <class A, class B, typename U>
   types::ndarray<typename A::dtype, types::pshape<long>>
   correlate(A const &inA, B const &inB, U type)
   {
-    long NA = inA.template shape<0>();
-    long NB = inB.template shape<0>();
-    // If inB is longer than inA, swap them, but time-reverse and conjugate the
-    // output (-1 flag)
-    if (NA > NB) {
-      auto inB_conj = functor::conjugate{}(inB);
-      return do_correlate(inA, inB_conj, type, 1);
-    } else {
-      auto inA_conj = functor::conjugate{}(inA);
-      return do_correlate(inB, inA_conj, type, -1);
-    }
+    using out_type =
+        typename __combined<typename A::dtype, typename B::dtype>::type;
+    // At this point, handling views would slow things down tremendously
+    auto const &a = functor::asarray{}(inA);
+    auto const &v = functor::asarray{}(inB);
+    long NA = a.template shape<0>();
+    long NV = v.template shape<0>();
+
+    // The window is the shortest input. When it is the first one, the
+    // roles are swapped, which reverses the output.
+    bool swapped = NA < NV;
+    std::vector<out_type> xs, ws;
+    out_type const *x = swapped ? details::as_contiguous(v, true, xs)
+                                : details::as_contiguous(a, false, xs);
+    out_type const *w = swapped ? details::as_contiguous(a, false, ws)
+                                : details::as_contiguous(v, true, ws);
+    long nx = std::max(NA, NV), nw = std::min(NA, NV);
+
+    long left, outN;
+    details::correlate_bounds(type, nx, nw, left, outN);
+    types::ndarray<out_type, types::pshape<long>> out{outN, builtins::None};
+    details::correlate_kernel(x, nx, w, nw, left, out.buffer, outN);
+    if (swapped)
+      std::reverse(out.buffer, out.buffer + outN);
+    return out;
   }
 
   template <class A, class B>
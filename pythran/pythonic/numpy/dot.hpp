@@ -7,6 +7,10 @@
 #include "pythonic/numpy/sum.hpp"
 #include "pythonic/numpy/multiply.hpp"
 #include "pythonic/types/traits.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+
+#include <algorithm>
+#include <functional>
 
 #ifdef PYTHRAN_BLAS_NONE
 #error pythran configured without BLAS but BLAS seem needed
@@ -129,9 +133,9 @@ namespace numpy
 /// Matrice / Vector multiplication
 
 #define MV_DEF(T, L)                                                           \
-  void mv(int m, int n, T *A, T *B, T *C)                                      \
+  void mv(int m, int n, T *A, T *B, T *C, T beta = 0)                          \
   {                                                                            \
-    cblas_##L##gemv(CblasRowMajor, CblasNoTrans, n, m, 1, A, m, B, 1, 0, C,    \
+    cblas_##L##gemv(CblasRowMajor, CblasNoTrans, n, m, 1, A, m, B, 1, beta, C, \
                     1);                                                        \
   }
 
@@ -140,9 +144,9 @@ namespace numpy
 
 #undef MV_DEF
 #define MV_DEF(T, K, L)                                                        \
-  void mv(int m, int n, T *A, T *B, T *C)                                      \
+  void mv(int m, int n, T *A, T *B, T *C, T beta = 0)                          \
   {                                                                            \
-    T alpha = 1, beta = 0;                                                     \
+    T alpha = 1;                                                               \
     cblas_##L##gemv(CblasRowMajor, CblasNoTrans, n, m, (K *)&alpha, (K *)A, m, \
                     (K *)B, 1, (K *)&beta, (K *)C, 1);                         \
   }
@@ -166,9 +170,10 @@ namespace numpy
 
 // The trick is to ! transpose the matrix so that MV become VM
 #define VM_DEF(T, L)                                                           \
-  void vm(int m, int n, T *A, T *B, T *C)                                      \
+  void vm(int m, int n, T *A, T *B, T *C, T beta = 0)                          \
   {                                                                            \
-    cblas_##L##gemv(CblasRowMajor, CblasTrans, n, m, 1, A, m, B, 1, 0, C, 1);  \
+    cblas_##L##gemv(CblasRowMajor, CblasTrans, n, m, 1, A, m, B, 1, beta, C,   \
+                    1);                                                        \
   }
 
   VM_DEF(double, d)
@@ -176,9 +181,9 @@ namespace numpy
 
 #undef VM_DEF
 #define VM_DEF(T, K, L)                                                        \
-  void vm(int m, int n, T *A, T *B, T *C)                                      \
+  void vm(int m, int n, T *A, T *B, T *C, T beta = 0)                          \
   {                                                                            \
-    T alpha = 1, beta = 0;                                                     \
+    T alpha = 1;                                                               \
     cblas_##L##gemv(CblasRowMajor, CblasTrans, n, m, (K *)&alpha, (K *)A, m,   \
                     (K *)B, 1, (K *)&beta, (K *)C, 1);                         \
   }
@@ -299,18 +304,18 @@ namespace numpy
 /// Matrix / Matrix multiplication
 
 #define MM_DEF(T, L)                                                           \
-  void mm(int m, int n, int k, T *A, T *B, T *C)                               \
+  void mm(int m, int n, int k, T *A, T *B, T *C, T beta = 0)                   \
   {                                                                            \
     cblas_##L##gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1, A,  \
-                    k, B, n, 0, C, n);                                         \
+                    k, B, n, beta, C, n);                                      \
   }
   MM_DEF(double, d)
   MM_DEF(float, s)
 #undef MM_DEF
 #define MM_DEF(T, K, L)                                                        \
-  void mm(int m, int n, int k, T *A, T *B, T *C)                               \
+  void mm(int m, int n, int k, T *A, T *B, T *C, T beta = 0)                   \
   {                                                                            \
-    T alpha = 1, beta = 0;                                                     \
+    T alpha = 1;                                                               \
     cblas_##L##gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,        \
                     (K *)&alpha, (K *)A, k, (K *)B, n, (K *)&beta, (K *)C, n); \
   }
@@ -334,21 +339,6 @@ namespace numpy
     return out;
   }
 
-  template <class E, class pS0, class pS1, class pS2>
-  typename std::enable_if<
-      is_blas_type<E>::value && std::tuple_size<pS0>::value == 2 &&
-          std::tuple_size<pS1>::value == 2 && std::tuple_size<pS2>::value == 2,
-      types::ndarray<E, pS2>>::type &
-  dot(types::ndarray<E, pS0> const &a, types::ndarray<E, pS1> const &b,
-      types::ndarray<E, pS2> &c)
-  {
-    int n = b.template shape<1>(), m = a.template shape<0>(),
-        k = b.template shape<0>();
-
-    mm(m, n, k, a.buffer, b.buffer, c.buffer);
-    return c;
-  }
-
 #define TM_DEF(T, L)                                                           \
   void tm(int m, int n, int k, T *A, T *B, T *C)                               \
   {                                                                            \
@@ -511,6 +501,123 @@ namespace numpy
               f[types::array<long, 2>{{k, j}}];
     return out;
   }
+
+  /// Products written into a preallocated array
+
+  namespace details
+  {
+    template <class T>
+    bool overlaps(T const *a, long na, T const *b, long nb)
+    {
+      std::less<T const *> less;
+      return less(a, b + nb) && less(b, a + na);
+    }
+
+    template <class T>
+    void product(long m, long n, long k, T *a, T *b, T *c, T beta,
+                 std::false_type)
+    {
+      for (long i = 0; i < m; ++i) {
+        T *row = c + i * n;
+        if (beta == T(0))
+          std::fill(row, row + n, T(0));
+        for (long l = 0; l < k; ++l) {
+          T v = a[i * k + l];
+          T const *other = b + l * n;
+          for (long j = 0; j < n; ++j)
+            row[j] += v * other[j];
+        }
+      }
+    }
+
+    template <class T>
+    void product(long m, long n, long k, T *a, T *b, T *c, T beta,
+                 std::true_type)
+    {
+      if (m == 0 || n == 0 || k == 0)
+        product(m, n, k, a, b, c, beta, std::false_type{});
+      else if (m == 1)
+        vm(n, k, b, a, c, beta);
+      else if (n == 1)
+        mv(k, m, a, b, c, beta);
+      else
+        mm(m, n, k, a, b, c, beta);
+    }
+
+    // c = beta * c + e . f, c holding the m x n result. Returns false,
+    // leaving c untouched, if the operands share memory with c.
+    template <class T, class pS0, class pS1>
+    bool dot_into(types::ndarray<T, pS0> const &e,
+                  types::ndarray<T, pS1> const &f, T *c, T beta)
+    {
+      constexpr long N0 = std::tuple_size<pS0>::value,
+                     N1 = std::tuple_size<pS1>::value;
+      auto se = sutils::getshape(e);
+      auto sf = sutils::getshape(f);
+      long m = N0 == 2 ? se[0] : 1, k = se[N0 - 1],
+           n = N1 == 2 ? sf[N1 - 1] : 1;
+      if (sf[0] != k)
+        throw types::ValueError("matrices are not aligned");
+      if (overlaps<T>(c, m * n, e.buffer, m * k) ||
+          overlaps<T>(c, m * n, f.buffer, k * n))
+        return false;
+      product(m, n, k, e.buffer, f.buffer, c, beta,
+              std::integral_constant<bool, is_blas_type<T>::value>{});
+      return true;
+    }
+
+    template <class E, class F, class T>
+    bool dot_into(E const &, F const &, T *, T)
+    {
+      return false;
+    }
+
+    template <class S, class E, class F>
+    bool is_dot_shape(S const &shape, E const &e, F const &f)
+    {
+      auto se = sutils::getshape(e);
+      auto sf = sutils::getshape(f);
+      return std::equal(se.begin(), se.end() - 1, shape.begin()) &&
+             (F::value == 1 || shape[shape.size() - 1] == sf[1]);
+    }
+  }
+
+  template <class E, class F, class T, class pS>
+  typename std::enable_if<
+      types::is_numexpr_arg<E>::value && types::is_numexpr_arg<F>::value &&
+          E::value <= 2 && F::value <= 2 && E::value + F::value >= 3 &&
+          std::tuple_size<pS>::value == E::value + F::value - 2,
+      types::ndarray<T, pS>>::type &
+  dot(E const &e, F const &f, types::ndarray<T, pS> &out)
+  {
+    if (!details::is_dot_shape(sutils::getshape(out), e, f))
+      throw types::ValueError("output array is not acceptable (must have the "
+                              "right datatype, number of dimensions, and be a "
+                              "C-Array)");
+    if (!details::dot_into(e, f, out.buffer, T(0))) {
+      auto result = dot(e, f);
+      std::copy(result.buffer, result.buffer + result.flat_size(), out.buffer);
+    }
+    return out;
+  }
+
+  template <class X, class E, class F>
+  void dot_accumulate(X &&x, E const &e, F const &f)
+  {
+    x += dot(e, f);
+  }
+
+  template <class T, class pS, class E, class F>
+  typename std::enable_if<
+      types::is_numexpr_arg<E>::value && types::is_numexpr_arg<F>::value &&
+          E::value <= 2 && F::value <= 2 && E::value + F::value >= 3 &&
+          std::tuple_size<pS>::value == E::value + F::value - 2>::type
+  dot_accumulate(types::ndarray<T, pS> &x, E const &e, F const &f)
+  {
+    if (!details::is_dot_shape(sutils::getshape(x), e, f) ||
+        !details::dot_into(e, f, x.buffer, T(1)))
+      x += dot(e, f);
+  }
 }
 PYTHONIC_NS_END
 
@@ -0,0 +1,169 @@
+#ifndef PYTHONIC_NUMPY_EINSUM_HPP
+#define PYTHONIC_NUMPY_EINSUM_HPP
+
+#include "pythonic/include/numpy/einsum.hpp"
+
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/contract.hpp"
+#include "pythonic/utils/seq.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // Splits the subscripts into the labels of each operand and the labels
+    // of the result, which default to the labels used only once, sorted.
+    void einsum_parse(types::str const &subscripts, long noperands,
+                      std::vector<std::vector<int>> &inputs,
+                      std::vector<int> &output)
+    {
+      std::string const &s = subscripts.chars();
+      size_t arrow = s.find("->");
+      std::string lhs = s.substr(0, arrow);
+      inputs.assign(1, {});
+      for (char c : lhs) {
+        if (c == ',')
+          inputs.emplace_back();
+        else if (std::isalpha(c))
+          inputs.back().push_back(c);
+        else if (c == '.')
+          throw types::ValueError("einsum: ellipsis is not supported");
+        else if (c != ' ')
+          throw types::ValueError("invalid subscript in einstein sum "
+                                  "subscripts string");
+      }
+      if ((long)inputs.size() != noperands)
+        throw types::ValueError("number of operands does not match the "
+                                "einstein sum subscripts string");
+
+      output.clear();
+      if (arrow == std::string::npos) {
+        for (int c = 0; c < 128; ++c)
+          if (std::isalpha(c) && std::count(lhs.begin(), lhs.end(), c) == 1)
+            output.push_back(c);
+        return;
+      }
+      for (char c : s.substr(arrow + 2)) {
+        if (c == ' ')
+          continue;
+        if (!std::isalpha(c))
+          throw types::ValueError("invalid subscript in einstein sum "
+                                  "subscripts string");
+        if (std::count(output.begin(), output.end(), c))
+          throw types::ValueError("einstein sum subscripts string includes "
+                                  "output subscript multiple times");
+        if (!std::count(lhs.begin(), lhs.end(), c))
+          throw types::ValueError("einstein sum subscripts string included "
+                                  "output subscript which never appeared in "
+                                  "an input");
+        output.push_back(c);
+      }
+    }
+
+    template <class T, class A>
+    typename std::enable_if<std::is_same<T, typename A::dtype>::value>::type
+    einsum_buffer(A const &array, utils::tensor<T> &t)
+    {
+      t.data = array.buffer;
+    }
+    template <class T, class A>
+    typename std::enable_if<!std::is_same<T, typename A::dtype>::value>::type
+    einsum_buffer(A const &array, utils::tensor<T> &t)
+    {
+      t.storage.assign(array.buffer, array.buffer + array.flat_size());
+      t.data = t.storage.data();
+    }
+
+    template <class T, class A>
+    utils::tensor<T> einsum_operand(A const &array,
+                                    std::vector<int> const &labels)
+    {
+      auto shape = sutils::getshape(array);
+      if (shape.size() != labels.size())
+        throw types::ValueError("einstein sum subscripts string does not "
+                                "match the number of dimensions of an "
+                                "operand");
+      utils::tensor<T> t;
+      t.shape.assign(shape.begin(), shape.end());
+      t.labels = labels;
+      einsum_buffer(array, t);
+      return t;
+    }
+
+    template <class T, class Arrays, size_t... Is>
+    std::vector<utils::tensor<T>>
+    einsum_operands(Arrays const &arrays,
+                    std::vector<std::vector<int>> const &inputs,
+                    utils::index_sequence<Is...>)
+    {
+      std::vector<utils::tensor<T>> operands;
+      operands.reserve(sizeof...(Is));
+      std::initializer_list<int> _ = {(operands.push_back(einsum_operand<T>(
+                                           std::get<Is>(arrays), inputs[Is])),
+                                       0)...};
+      (void)_;
+      return operands;
+    }
+
+    template <long R, class T>
+    typename std::enable_if<R != 0, typename einsum_result<R, T>::type>::type
+    einsum_output(utils::tensor<T> const &res)
+    {
+      types::array<long, R> shape;
+      std::copy(res.shape.begin(), res.shape.end(), shape.begin());
+      typename einsum_result<R, T>::type out(shape, builtins::None);
+      std::copy(res.data, res.data + res.size(), out.buffer);
+      return out;
+    }
+    template <long R, class T>
+    typename std::enable_if<R == 0, T>::type
+    einsum_output(utils::tensor<T> const &res)
+    {
+      return res.data[0];
+    }
+  }
+
+  template <long R, class... Ops>
+  typename details::einsum_result<
+      R, typename __combined<typename types::dtype_of<Ops>::type...>::type>::
+      type
+      einsum(std::integral_constant<long, R>, types::str const &subscripts,
+             Ops const &... ops)
+  {
+    using T =
+        typename __combined<typename types::dtype_of<Ops>::type...>::type;
+    std::vector<std::vector<int>> inputs;
+    std::vector<int> output;
+    details::einsum_parse(subscripts, sizeof...(Ops), inputs, output);
+    if (output.size() != R)
+      throw types::ValueError("einstein sum subscripts string does not "
+                              "match the rank of the result");
+
+    auto arrays = std::make_tuple(asarray(ops)...);
+    auto operands = details::einsum_operands<T>(
+        arrays, inputs, utils::make_index_sequence<sizeof...(Ops)>());
+
+    std::vector<long> extents(128, -1);
+    for (auto const &operand : operands)
+      for (size_t d = 0; d < operand.labels.size(); ++d) {
+        long &extent = extents[operand.labels[d]];
+        if (extent >= 0 && extent != operand.shape[d])
+          throw types::ValueError("operands could not be broadcast together "
+                                  "in einstein sum");
+        extent = operand.shape[d];
+      }
+
+    return details::einsum_output<R>(
+        utils::contract_all(std::move(operands), output, extents));
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -3,40 +3,24 @@
 
 #include "pythonic/include/numpy/flatnonzero.hpp"
 
+#include "pythonic/utils/nonzero.hpp"
 #include "pythonic/numpy/asarray.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-  namespace
-  {
-    template <class I, class O>
-    void _flatnonzero(I begin, I end, O &out, long &i, utils::int_<1>)
-    {
-      for (; begin != end; ++begin, ++i)
-        if (*begin)
-          *out++ = i;
-    }
-
-    template <class I, class O, size_t N>
-    void _flatnonzero(I begin, I end, O &out, long &i, utils::int_<N>)
-    {
-      for (; begin != end; ++begin)
-        _flatnonzero((*begin).begin(), (*begin).end(), out, i,
-                     utils::int_<N - 1>());
-    }
-  }
   template <class E>
   types::ndarray<long, types::pshape<long>> flatnonzero(E const &expr)
   {
-    long n = expr.flat_size();
-    utils::shared_ref<types::raw_array<long>> buffer(n);
-    long *iter = buffer->data;
-    long i = 0;
-    _flatnonzero(expr.begin(), expr.end(), iter, i, utils::int_<E::value>());
-    types::pshape<long> shape = iter - buffer->data;
-    return types::ndarray<long, types::pshape<long>>(std::move(buffer), shape);
+    auto const &arr = asarray(expr);
+    auto counts = utils::count_nonzero_blocks(arr.buffer, arr.flat_size());
+    types::ndarray<long, types::pshape<long>> out(
+        types::pshape<long>(counts.total()), types::none_type{});
+    long *buffer = out.buffer;
+    utils::for_each_nonzero(arr.buffer, counts,
+                            [=](long pos, long i) { buffer[pos] = i; });
+    return out;
   }
 }
 PYTHONIC_NS_END
@@ -0,0 +1,153 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAM_HPP
+#define PYTHONIC_NUMPY_HISTOGRAM_HPP
+
+#include "pythonic/include/numpy/histogram.hpp"
+
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/utils/histogram.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // Bins of equal width span the range, when given, or the values.
+    template <class T>
+    void histogram_bounds(T const *data, long n, types::none_type, double &lo,
+                          double &hi)
+    {
+      utils::histogram_range(data, n, lo, hi);
+    }
+    template <class T, class R>
+    void histogram_bounds(T const *, long, R const &range, double &lo,
+                          double &hi)
+    {
+      lo = std::get<0>(range);
+      hi = std::get<1>(range);
+      utils::histogram_range(lo, hi);
+    }
+
+    // `bins' is either a number of bins or an array of edges, in which case
+    // the range is ignored.
+    template <class T, class B, class R>
+    typename std::enable_if<std::is_integral<B>::value, utils::binner>::type
+    make_binner(T const *data, long n, B const &bins, R const &range)
+    {
+      if (bins < 1)
+        throw types::ValueError("`bins` must be positive, when an integer");
+      double lo, hi;
+      histogram_bounds(data, n, range, lo, hi);
+      return {lo, hi, (long)bins};
+    }
+    template <class T, class B, class R>
+    typename std::enable_if<!std::is_integral<B>::value, utils::binner>::type
+    make_binner(T const *, long, B const &bins, R const &)
+    {
+      auto const &edges = asarray(bins);
+      return {edges.buffer, edges.flat_size()};
+    }
+
+    template <class W>
+    struct histogram_weights {
+      typename std::decay<decltype(asarray(std::declval<W const &>()))>::type
+          values;
+
+      histogram_weights(W const &weights, long n) : values(asarray(weights))
+      {
+        if (values.flat_size() != n)
+          throw types::ValueError("weights should have the same shape as a.");
+      }
+      utils::array_weight<typename decltype(values)::dtype> get() const
+      {
+        return {values.buffer};
+      }
+    };
+    template <>
+    struct histogram_weights<types::none_type> {
+      histogram_weights(types::none_type, long)
+      {
+      }
+      utils::unit_weight get() const
+      {
+        return {};
+      }
+    };
+
+    bool is_density(types::none_type)
+    {
+      return false;
+    }
+    template <class D>
+    bool is_density(D const &density)
+    {
+      return density;
+    }
+
+    // Turns the counts of a row-major histogram into a probability density.
+    template <class C>
+    void histogram_density(C *hist, std::vector<utils::binner> const &binners)
+    {
+      long size = 1;
+      for (auto const &binner : binners)
+        size *= binner.size();
+      C total = std::accumulate(hist, hist + size, C());
+      for (long i = 0; i < size; ++i) {
+        double volume = 1;
+        for (long d = binners.size() - 1, r = i; d >= 0; --d) {
+          auto const &edges = binners[d].edges();
+          long k = r % binners[d].size();
+          r /= binners[d].size();
+          volume *= edges[k + 1] - edges[k];
+        }
+        hist[i] = hist[i] / total / volume;
+      }
+    }
+
+    types::ndarray<double, types::pshape<long>>
+    histogram_edges(utils::binner const &binner)
+    {
+      auto const &edges = binner.edges();
+      types::ndarray<double, types::pshape<long>> out(
+          types::pshape<long>(edges.size()), builtins::None);
+      std::copy(edges.begin(), edges.end(), out.buffer);
+      return out;
+    }
+  }
+
+  template <class E, class B, class R, class D, class W>
+  std::tuple<
+      types::ndarray<typename details::histogram_count<W, D>::type,
+                     types::pshape<long>>,
+      types::ndarray<double, types::pshape<long>>>
+  histogram(E const &a, B const &bins, R const &range, D const &density,
+            W const &weights)
+  {
+    using count_type = typename details::histogram_count<W, D>::type;
+    auto const &values = asarray(a);
+    long n = values.flat_size();
+    std::vector<utils::binner> binners = {
+        details::make_binner(values.buffer, n, bins, range)};
+    details::histogram_weights<W> w(weights, n);
+
+    auto const &binner = binners.front();
+    types::ndarray<count_type, types::pshape<long>> hist(
+        types::pshape<long>(binner.size()), count_type(0));
+    utils::accumulate_bins(n, binner.size(),
+                           [&](long i) { return binner(values.buffer[i]); },
+                           w.get(), hist.buffer);
+    if (details::is_density(density))
+      details::histogram_density(hist.buffer, binners);
+    return std::make_tuple(hist, details::histogram_edges(binner));
+  }
+}
+PYTHONIC_NS_END
+
+#endif
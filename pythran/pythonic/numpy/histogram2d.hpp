@@ -0,0 +1,29 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAM2D_HPP
+#define PYTHONIC_NUMPY_HISTOGRAM2D_HPP
+
+#include "pythonic/include/numpy/histogram2d.hpp"
+
+#include "pythonic/numpy/histogramdd.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class X, class Y, class B, class R, class D, class W>
+  std::tuple<types::ndarray<typename details::histogram_count<W, D>::type,
+                            types::array<long, 2>>,
+             types::ndarray<double, types::pshape<long>>,
+             types::ndarray<double, types::pshape<long>>>
+  histogram2d(X const &x, Y const &y, B const &bins, R const &range,
+              D const &density, W const &weights)
+  {
+    auto res = details::histogramdd(std::tie(x, y), bins, range, density,
+                                    weights, utils::make_index_sequence<2>());
+    return std::make_tuple(res.first,
+                           details::histogram_edges(res.second[0]),
+                           details::histogram_edges(res.second[1]));
+  }
+}
+PYTHONIC_NS_END
+
+#endif
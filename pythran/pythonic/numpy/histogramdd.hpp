@@ -0,0 +1,116 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAMDD_HPP
+#define PYTHONIC_NUMPY_HISTOGRAMDD_HPP
+
+#include "pythonic/include/numpy/histogramdd.hpp"
+
+#include "pythonic/numpy/histogram.hpp"
+#include "pythonic/types/list.hpp"
+#include "pythonic/utils/seq.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class P>
+    struct is_per_dimension : std::false_type {
+    };
+    template <class... Ts>
+    struct is_per_dimension<std::tuple<Ts...>> : std::true_type {
+    };
+    template <class T, size_t N, class V>
+    struct is_per_dimension<types::array_base<T, N, V>> : std::true_type {
+    };
+
+    template <size_t I, class P>
+    auto dimension_param(P const &p) -> typename std::enable_if<
+        is_per_dimension<P>::value, decltype(std::get<I>(p))>::type
+    {
+      return std::get<I>(p);
+    }
+    template <size_t I, class P>
+    typename std::enable_if<!is_per_dimension<P>::value, P const &>::type
+    dimension_param(P const &p)
+    {
+      return p;
+    }
+
+    // Bins one coordinate of the sample, and folds the bin index into the
+    // row-major index of each point in the histogram, -1 meaning that the
+    // point falls outside.
+    template <class E, class B, class R>
+    utils::binner histogram_dimension(E const &x, B const &bins,
+                                      R const &range, std::vector<long> &index,
+                                      long &n)
+    {
+      auto const &values = asarray(x);
+      if (n < 0) {
+        n = values.flat_size();
+        index.resize(n);
+      } else if (values.flat_size() != n)
+        throw types::ValueError(
+            "all the sample arrays must have the same length");
+      utils::binner binner = make_binner(values.buffer, n, bins, range);
+      long nbins = binner.size();
+      long *idx = index.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+      for (long i = 0; i < n; ++i) {
+        long k = binner(values.buffer[i]);
+        idx[i] = (k < 0 || idx[i] < 0) ? -1 : idx[i] * nbins + k;
+      }
+      return binner;
+    }
+
+    template <class S, class B, class R, class D, class W, size_t... Is>
+    std::pair<types::ndarray<typename histogram_count<W, D>::type,
+                             types::array<long, sizeof...(Is)>>,
+              std::vector<utils::binner>>
+    histogramdd(S const &sample, B const &bins, R const &range,
+                D const &density, W const &weights,
+                utils::index_sequence<Is...>)
+    {
+      using count_type = typename histogram_count<W, D>::type;
+      std::vector<long> index;
+      long n = -1;
+      // braced initializers are evaluated in order, so is the index
+      std::vector<utils::binner> binners = {histogram_dimension(
+          std::get<Is>(sample), dimension_param<Is>(bins),
+          dimension_param<Is>(range), index, n)...};
+      histogram_weights<W> w(weights, n);
+
+      types::array<long, sizeof...(Is)> shape;
+      long size = 1;
+      for (size_t d = 0; d < sizeof...(Is); ++d)
+        size *= shape[d] = binners[d].size();
+      types::ndarray<count_type, types::array<long, sizeof...(Is)>> hist(
+          shape, count_type(0));
+      utils::accumulate_bins(n, size, [&](long i) { return index[i]; },
+                             w.get(), hist.buffer);
+      if (is_density(density))
+        histogram_density(hist.buffer, binners);
+      return {hist, binners};
+    }
+  }
+
+  template <class S, class B, class R, class D, class W>
+  std::tuple<types::ndarray<typename details::histogram_count<W, D>::type,
+                            types::array<long, std::tuple_size<S>::value>>,
+             types::list<types::ndarray<double, types::pshape<long>>>>
+  histogramdd(S const &sample, B const &bins, R const &range, D const &density,
+              W const &weights)
+  {
+    auto res = details::histogramdd(
+        sample, bins, range, density, weights,
+        utils::make_index_sequence<std::tuple_size<S>::value>());
+    types::list<types::ndarray<double, types::pshape<long>>> edges(0);
+    for (auto const &binner : res.second)
+      edges.push_back(details::histogram_edges(binner));
+    return std::make_tuple(res.first, edges);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
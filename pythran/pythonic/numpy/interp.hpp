@@ -2,24 +2,56 @@
 #define PYTHONIC_NUMPY_INTERP_HPP
 
 #include "pythonic/include/numpy/interp.hpp"
-#include "pythonic/include/numpy/remainder.hpp"
-#include "pythonic/include/numpy/argsort.hpp"
-#include <pythonic/include/numpy/concatenate.hpp>
-
-#include <pythonic/numpy/remainder.hpp>
-#include "pythonic/numpy/argsort.hpp"
-#include <pythonic/numpy/concatenate.hpp>
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/interp_core.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    struct interp_identity {
+      template <class T>
+      double operator()(T const &value) const
+      {
+        return value;
+      }
+    };
+
+    // remainder of the division by a positive period, as numpy.remainder
+    struct interp_period {
+      double period;
+      template <class T>
+      double operator()(T const &value) const
+      {
+        double r = std::fmod((double)value, period);
+        return r < 0 ? r + period : r;
+      }
+    };
+
+    // run before the default left and right values are read from fp
+    template <class T2, class T3>
+    void interp_check(T2 const &xp, T3 const &fp)
+    {
+      long lenxp = xp.template shape<0>();
+      if (lenxp == 0)
+        throw types::ValueError("array of sample points is empty");
+      if (fp.template shape<0>() != lenxp)
+        throw types::ValueError("fp and xp are not of the same length.");
+    }
+  }
+
   template <class T1, class T2, class T3, typename t1, typename t2, typename t3>
   types::ndarray<double, types::pshape<long>>
   interp(T1 x, T2 xp, T3 fp, t1 _left, t2 _right, t3 _period)
@@ -27,45 +59,44 @@ namespace numpy
 
     double left = _left;
     double right = _right;
-    double period = _period;
-    // Todo: what to do if this condition isn't satisfied? Can't use a statis
-    // assert because the size isn't known at compile time.
-    assert(xp.template shape<0>() == fp.template shape<0>());
-    double outVal(0);
+    double period = std::abs((double)_period);
+    long lenxp = xp.template shape<0>();
+    long lenx = x.template shape<0>();
+    details::interp_check(xp, fp);
 
-    types::ndarray<double, types::pshape<long>> out = {
-        (long)(x.template shape<0>()), outVal};
+    types::ndarray<double, types::pshape<long>> out(types::pshape<long>{lenx},
+                                                   builtins::None);
 
     if (period) {
-      auto x_rem = pythonic::numpy::functor::remainder{}(x, period);
-      auto xp_rem = pythonic::numpy::functor::remainder{}(xp, period);
-      auto idx = pythonic::numpy::functor::argsort{}(xp_rem);
-      auto xp_sorted = xp_rem[idx];
-      auto fp_sorted = fp[idx];
-
-      auto left_pad_xp =
-          types::ndarray<typename T2::dtype, types::pshape<long>>(
-              types::pshape<long>(1), xp_sorted[-1] - period);
-      auto right_pad_xp =
-          types::ndarray<typename T2::dtype, types::pshape<long>>(
-              types::pshape<long>(1), xp_sorted[0] + period);
-      auto new_xp = pythonic::numpy::functor::concatenate{}(
-          pythonic::types::make_tuple(left_pad_xp, xp_sorted, right_pad_xp));
-
-      auto left_pad_fp = types::ndarray<double, types::pshape<long>>(
-          types::pshape<long>(1), fp_sorted[-1]);
-      auto right_pad_fp = types::ndarray<double, types::pshape<long>>(
-          types::pshape<long>(1), fp_sorted[0]);
-      auto new_fp = pythonic::numpy::functor::concatenate{}(
-          pythonic::types::make_tuple(left_pad_fp, fp_sorted, right_pad_fp));
-
-      auto lenxp = new_xp.size();
-      auto lenx = x_rem.size();
-      do_interp(x_rem, new_xp, new_fp, out, lenxp, lenx, 0., 0.);
+      // sample points sorted by remainder, padded by their periodic images,
+      // the queries being reduced on the fly
+      details::interp_period key{period};
+      std::vector<std::pair<double, double>> points(lenxp);
+      for (long i = 0; i < lenxp; ++i)
+        points[i] = std::make_pair(key(xp[i]), (double)fp[i]);
+      std::stable_sort(
+          points.begin(), points.end(),
+          [](std::pair<double, double> const &a,
+             std::pair<double, double> const &b) { return a.first < b.first; });
+
+      std::vector<double> xs(lenxp + 2), fs(lenxp + 2);
+      for (long i = 0; i < lenxp; ++i) {
+        xs[i + 1] = points[i].first;
+        fs[i + 1] = points[i].second;
+      }
+      xs[0] = xs[lenxp] - period;
+      fs[0] = fs[lenxp];
+      xs[lenxp + 1] = xs[1] + period;
+      fs[lenxp + 1] = fs[1];
+      do_interp(x, xs.data(), fs.data(), out, lenxp + 2, lenx, 0., 0., key);
     } else {
-      auto lenxp = xp.size();
-      auto lenx = x.size();
-      do_interp(x, xp, fp, out, lenxp, lenx, left, right);
+      std::vector<double> xs(lenxp), fs(lenxp);
+      for (long i = 0; i < lenxp; ++i) {
+        xs[i] = xp[i];
+        fs[i] = fp[i];
+      }
+      do_interp(x, xs.data(), fs.data(), out, lenxp, lenx, left, right,
+                details::interp_identity{});
     }
 
     return out;
@@ -77,6 +108,7 @@ namespace numpy
   interp(T1 x, T2 xp, T3 fp, types::none_type left, types::none_type right,
          types::none_type period)
   {
+    details::interp_check(xp, fp);
     auto _left = fp[0];
     auto _right = fp[-1];
     return interp(x, xp, fp, _left, _right, 0.);
@@ -88,6 +120,7 @@ namespace numpy
   interp(T1 x, T2 xp, T3 fp, t1 left, types::none_type right,
          types::none_type period)
   {
+    details::interp_check(xp, fp);
     auto _right = fp[-1];
     return interp(x, xp, fp, left, _right, 0.);
   }
@@ -97,6 +130,7 @@ namespace numpy
   interp(T1 x, T2 xp, T3 fp, types::none_type left, t1 right,
          types::none_type period)
   {
+    details::interp_check(xp, fp);
     auto _left = fp[0];
     return interp(x, xp, fp, _left, right, 0.);
   }
@@ -106,7 +140,8 @@ namespace numpy
   interp(T1 x, T2 xp, T3 fp, types::none_type left, types::none_type right,
          t1 period)
   {
-    assert(period != 0);
+    if (period == 0)
+      throw types::ValueError("period must be a non-zero value");
     return interp(x, xp, fp, 0., 0., period);
   }
 
@@ -1,107 +1,16 @@
 //
 //  From NumpySrc/numpy/core/src/multiarray/compiled_base.c
 
-/** @brief find index of a sorted array such that arr[i] <= key < arr[i + 1].
- *
- * If an starting index guess is in-range, the array values around this
- * index are first checked.  This allows for repeated calls for well-ordered
- * keys (a very common case) to use the previous index as a very good guess.
- *
- * If the guess value is not useful, bisection of the array is used to
- * find the index.  If there is no such index, the return values are:
- *     key < arr[0] -- -1
- *     key == arr[len - 1] -- len - 1
- *     key > arr[len - 1] -- len
- * The array is assumed contiguous and sorted in ascending order.
- *
- * @param key key value.
- * @param arr contiguous sorted array to be searched.
- * @param len length of the array.
- * @param guess initial guess of index
- * @return index
- */
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/searchsorted.hpp"
 #include "pythonic/numpy/isnan.hpp"
 
-#define LIKELY_IN_CACHE_SIZE 8
-
-template <typename npy_intp, typename npy_double, class T>
-static npy_intp binary_search_with_guess(const npy_double key, const T &arr,
-                                         npy_intp len, npy_intp guess)
-{
-  npy_intp imin = 0;
-  npy_intp imax = len;
-
-  /* Handle keys outside of the arr range first */
-  if (key > arr[len - 1]) {
-    return len;
-  } else if (key < arr[0]) {
-    return -1;
-  }
-
-  /*
-   * If len <= 4 use linear search.
-   * From above we know key >= arr[0] when we start.
-   */
-  if (len <= 4) {
-    npy_intp i;
-
-    for (i = 1; i < len && key >= arr[i]; ++i)
-      ;
-    return i - 1;
-  }
-
-  if (guess > len - 3) {
-    guess = len - 3;
-  }
-  if (guess < 1) {
-    guess = 1;
-  }
+#include <vector>
 
-  /* check most likely values: guess - 1, guess, guess + 1 */
-  if (key < arr[guess]) {
-    if (key < arr[guess - 1]) {
-      imax = guess - 1;
-      /* last attempt to restrict search to items in cache */
-      if (guess > LIKELY_IN_CACHE_SIZE &&
-          key >= arr[guess - LIKELY_IN_CACHE_SIZE]) {
-        imin = guess - LIKELY_IN_CACHE_SIZE;
-      }
-    } else {
-      /* key >= arr[guess - 1] */
-      return guess - 1;
-    }
-  } else {
-    /* key >= arr[guess] */
-    if (key < arr[guess + 1]) {
-      return guess;
-    } else {
-      /* key >= arr[guess + 1] */
-      if (key < arr[guess + 2]) {
-        return guess + 1;
-      } else {
-        /* key >= arr[guess + 2] */
-        imin = guess + 2;
-        /* last attempt to restrict search to items in cache */
-        if (guess < len - LIKELY_IN_CACHE_SIZE - 1 &&
-            key < arr[guess + LIKELY_IN_CACHE_SIZE]) {
-          imax = guess + LIKELY_IN_CACHE_SIZE;
-        }
-      }
-    }
-  }
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
-  /* finally, find index by bisection */
-  while (imin < imax) {
-    const npy_intp imid = imin + ((imax - imin) >> 1);
-    if (key >= arr[imid]) {
-      imin = imid + 1;
-    } else {
-      imax = imid;
-    }
-  }
-  return imin - 1;
-}
 //
 //#undef LIKELY_IN_CACHE_SIZE
 //
@@ -183,68 +92,109 @@ static npy_intp binary_search_with_guess(const npy_double key, const T &arr,
 
 // xp->dx   fp->dy  x -> dz
 
-template <typename npy_intp, typename npy_double, class T1, class T2, class T3,
-          class T4>
-void do_interp(const T1 &dz, const T2 &dx, const T3 &dy, T4 &dres,
-               npy_intp lenxp, npy_intp lenx, npy_double lval, npy_double rval)
+/* xp and fp are contiguous and sorted along xp, and each query is read as
+ * key(dz[i]). The bins of a whole chunk of queries are located at once,
+ * then interpolated by a loop without branches, the few queries that fall
+ * outside of [xp[0], xp[lenxp - 1]), on a sample point or on a NaN being
+ * fixed afterwards.
+ */
+template <typename npy_intp, typename npy_double, class T1, class T4,
+          class Key>
+void do_interp(const T1 &dz, const npy_double *dx, const npy_double *dy,
+               T4 &dres, npy_intp lenxp, npy_intp lenx, npy_double lval,
+               npy_double rval, Key key)
 {
   npy_intp i;
   npy_double *slopes = NULL;
   std::vector<npy_double> slope_vect;
-  /* binary_search_with_guess needs at least a 3 item long array */
+  /* a single sample point defines no bin to search for */
   if (lenxp == 1) {
     const npy_double xp_val = dx[0];
     const npy_double fp_val = dy[0];
 
     //        NPY_BEGIN_THREADS_THRESHOLDED(lenx);
     for (i = 0; i < lenx; ++i) {
-      const npy_double x_val = dz[i];
+      const npy_double x_val = key(dz[i]);
       dres[i] = (x_val < xp_val) ? lval : ((x_val > xp_val) ? rval : fp_val);
     }
     //        NPY_END_THREADS;
-  } else {
-    npy_intp j = 0;
-
-    /* only pre-calculate slopes if there are relatively few of them. */
-    if (lenxp <= lenx) {
-      slope_vect.resize(lenxp - 1);
-      slopes = slope_vect.data();
-    }
+    return;
+  }
 
-    //        NPY_BEGIN_THREADS;
+  /* only pre-calculate slopes if there are relatively few of them. */
+  if (lenxp <= lenx) {
+    slope_vect.resize(lenxp - 1);
+    slopes = slope_vect.data();
+    for (i = 0; i < lenxp - 1; ++i)
+      slopes[i] = (dy[i + 1] - dy[i]) / (dx[i + 1] - dx[i]);
+  }
 
-    if (slopes != NULL) {
-      for (i = 0; i < lenxp - 1; ++i) {
-        slopes[i] = (dy[i + 1] - dy[i]) / (dx[i + 1] - dx[i]);
+  /* bins are such that xp[j] <= x_val < xp[j + 1], with j == -1 below xp[0]
+   * and j == lenxp - 1 from xp[lenxp - 1] on.
+   */
+  using searcher_type =
+      pythonic::utils::sorted_searcher<pythonic::utils::search_right,
+                                       npy_double>;
+  searcher_type searcher(pythonic::utils::search_right{}, dx, lenxp, lenx);
+  const npy_intp chunk = PYTHRAN_SEARCHSORTED_CHUNK_SIZE;
+  const npy_intp nchunks = (lenx + chunk - 1) / chunk;
+
+  auto interp_chunk = [&](npy_intp c) {
+    npy_double x_vals[PYTHRAN_SEARCHSORTED_CHUNK_SIZE] = {};
+    npy_double res[PYTHRAN_SEARCHSORTED_CHUNK_SIZE];
+    long bins[PYTHRAN_SEARCHSORTED_CHUNK_SIZE];
+    const npy_intp first = c * chunk;
+    const npy_intp count = std::min(chunk, lenx - first);
+    for (npy_intp k = 0; k < count; ++k)
+      x_vals[k] = key(dz[first + k]);
+    searcher(x_vals, count, bins);
+
+    // clamped to the first and last bins, fixed below
+    const long last_bin = lenxp - 2;
+    if (slopes != NULL)
+      for (npy_intp k = 0; k < count; ++k) {
+        const long j = std::min(std::max(bins[k] - 1, 0L), last_bin);
+        res[k] = slopes[j] * (x_vals[k] - dx[j]) + dy[j];
       }
-    }
-
-    for (i = 0; i < lenx; ++i) {
-      const npy_double x_val = dz[i];
-
-      if (pythonic::numpy::functor::isnan()(x_val)) {
-        dres[i] = x_val;
-        continue;
+    else
+      for (npy_intp k = 0; k < count; ++k) {
+        const long j = std::min(std::max(bins[k] - 1, 0L), last_bin);
+        const npy_double slope = (dy[j + 1] - dy[j]) / (dx[j + 1] - dx[j]);
+        res[k] = slope * (x_vals[k] - dx[j]) + dy[j];
       }
 
-      j = binary_search_with_guess(x_val, dx, lenxp, j);
-      if (j == -1) {
-        dres[i] = lval;
-      } else if (j == lenxp) {
-        dres[i] = rval;
+    for (npy_intp k = 0; k < count; ++k) {
+      const npy_double x_val = x_vals[k];
+      const npy_intp j = bins[k] - 1;
+      npy_double value = res[k];
+      if (pythonic::numpy::functor::isnan()(x_val)) {
+        value = x_val;
+      } else if (j == -1) {
+        value = lval;
       } else if (j == lenxp - 1) {
-        dres[i] = dy[j];
+        value = (x_val > dx[j]) ? rval : dy[j];
       } else if (dx[j] == x_val) {
         /* Avoid potential non-finite interpolation */
-        dres[i] = dy[j];
-      } else {
-        const npy_double slope =
-            (slopes != NULL) ? slopes[j]
-                             : (dy[j + 1] - dy[j]) / (dx[j + 1] - dx[j]);
-        dres[i] = slope * (x_val - dx[j]) + dy[j];
+        value = dy[j];
+      } else if (pythonic::numpy::functor::isnan()(value)) {
+        /* an infinite slope, approached from the other end */
+        value = (dy[j + 1] - dy[j]) / (dx[j + 1] - dx[j]) *
+                    (x_val - dx[j + 1]) +
+                dy[j + 1];
+        if (pythonic::numpy::functor::isnan()(value) && dy[j] == dy[j + 1])
+          value = dy[j];
       }
+      dres[first + k] = value;
     }
-
-    //        NPY_END_THREADS;
-  }
+  };
+
+#ifdef _OPENMP
+  if (nchunks > 1 && lenx >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+#pragma omp parallel for
+    for (npy_intp c = 0; c < nchunks; ++c)
+      interp_chunk(c);
+  } else
+#endif
+    for (npy_intp c = 0; c < nchunks; ++c)
+      interp_chunk(c);
 }
@@ -0,0 +1,44 @@
+#ifndef PYTHONIC_NUMPY_LINALG_CHOLESKY_HPP
+#define PYTHONIC_NUMPY_LINALG_CHOLESKY_HPP
+
+#include "pythonic/include/numpy/linalg/cholesky.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    template <class E>
+    types::ndarray<typename utils::linalg_type<typename E::dtype>::type,
+                   types::array<long, E::value>>
+    cholesky(E const &a)
+    {
+      using T = typename utils::linalg_type<typename E::dtype>::type;
+      auto const &arr = asarray(a);
+      using order = utils::matrix_order_of<decltype(arr)>;
+      auto shape = sutils::getshape(arr);
+      long n;
+      long count = utils::square_matrices(shape, n);
+
+      types::ndarray<T, types::array<long, E::value>> out(shape,
+                                                          builtins::None);
+      std::copy(arr.buffer, arr.buffer + arr.flat_size(), out.buffer);
+      T *dst = out.buffer;
+      auto m = order::make(n);
+      if (utils::for_each_matrix(count, n * n * n, [&](long i) {
+            return utils::cholesky_factor(dst + i * n * n, m);
+          }))
+        throw types::ValueError("Matrix is not positive definite");
+      return out;
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef PYTHONIC_NUMPY_LINALG_DET_HPP
+#define PYTHONIC_NUMPY_LINALG_DET_HPP
+
+#include "pythonic/include/numpy/linalg/det.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    namespace details
+    {
+      template <class T, class S, class N>
+      T det_kernel(S const *src, N n)
+      {
+        utils::scratch<T> lu(n * n);
+        utils::scratch<long> piv(n);
+        std::copy(src, src + n * n, lu.data());
+        if (utils::lu_factor(lu.data(), n, piv.data()))
+          return T(0);
+        T d = T(1);
+        for (long i = 0; i < n; ++i) {
+          d *= lu.data()[i * n + i];
+          if (piv.data()[i] != i)
+            d = -d;
+        }
+        return d;
+      }
+    }
+
+    template <class E>
+    typename std::enable_if<
+        E::value == 2,
+        typename utils::linalg_type<typename E::dtype>::type>::type
+    det(E const &a)
+    {
+      using T = typename utils::linalg_type<typename E::dtype>::type;
+      auto const &arr = asarray(a);
+      using order = utils::matrix_order_of<decltype(arr)>;
+      long n;
+      utils::square_matrices(sutils::getshape(arr), n);
+      return details::det_kernel<T>(arr.buffer, order::make(n));
+    }
+
+    template <class E>
+    typename std::enable_if<
+        (E::value > 2),
+        types::ndarray<typename utils::linalg_type<typename E::dtype>::type,
+                       types::array<long, E::value - 2>>>::type
+    det(E const &a)
+    {
+      using T = typename utils::linalg_type<typename E::dtype>::type;
+      auto const &arr = asarray(a);
+      using order = utils::matrix_order_of<decltype(arr)>;
+      auto shape = sutils::getshape(arr);
+      long n;
+      long count = utils::square_matrices(shape, n);
+
+      types::array<long, E::value - 2> out_shape;
+      std::copy(shape.begin(), shape.end() - 2, out_shape.begin());
+      types::ndarray<T, types::array<long, E::value - 2>> out(out_shape,
+                                                              builtins::None);
+      auto const *src = arr.buffer;
+      T *dst = out.buffer;
+      auto m = order::make(n);
+      utils::for_each_matrix(count, n * n * n, [&](long i) {
+        dst[i] = details::det_kernel<T>(src + i * n * n, m);
+        return 0L;
+      });
+      return out;
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
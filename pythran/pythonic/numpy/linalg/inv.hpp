@@ -0,0 +1,62 @@
+#ifndef PYTHONIC_NUMPY_LINALG_INV_HPP
+#define PYTHONIC_NUMPY_LINALG_INV_HPP
+
+#include "pythonic/include/numpy/linalg/inv.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    namespace details
+    {
+      template <class T, class S, class N>
+      long inv_kernel(S const *src, N n, T *dst)
+      {
+        utils::scratch<T> lu(n * n);
+        utils::scratch<long> piv(n);
+        std::copy(src, src + n * n, lu.data());
+        if (long info = utils::lu_factor(lu.data(), n, piv.data()))
+          return info;
+        std::fill(dst, dst + n * n, T(0));
+        for (long i = 0; i < n; ++i)
+          dst[i * n + i] = T(1);
+        utils::lu_solve(lu.data(), n, piv.data(), dst, n);
+        return 0;
+      }
+    }
+
+    template <class E>
+    types::ndarray<typename utils::linalg_type<typename E::dtype>::type,
+                   types::array<long, E::value>>
+    inv(E const &a)
+    {
+      using T = typename utils::linalg_type<typename E::dtype>::type;
+      auto const &arr = asarray(a);
+      using order = utils::matrix_order_of<decltype(arr)>;
+      auto shape = sutils::getshape(arr);
+      long n;
+      long count = utils::square_matrices(shape, n);
+
+      types::ndarray<T, types::array<long, E::value>> out(shape,
+                                                          builtins::None);
+      auto const *src = arr.buffer;
+      T *dst = out.buffer;
+      auto m = order::make(n);
+      if (utils::for_each_matrix(count, n * n * n, [&](long i) {
+            return details::inv_kernel(src + i * n * n, m, dst + i * n * n);
+          }))
+        throw types::ValueError("Singular matrix");
+      return out;
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
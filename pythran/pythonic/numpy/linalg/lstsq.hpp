@@ -0,0 +1,136 @@
+#ifndef PYTHONIC_NUMPY_LINALG_LSTSQ_HPP
+#define PYTHONIC_NUMPY_LINALG_LSTSQ_HPP
+
+#include "pythonic/include/numpy/linalg/lstsq.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/linalg.hpp"
+
+#include <functional>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    namespace details
+    {
+      template <class B, class T>
+      typename std::enable_if<B::value == 1,
+                              types::ndarray<T, types::array<long, 1>>>::type
+      lstsq_solution(long n, long)
+      {
+        return types::ndarray<T, types::array<long, 1>>(
+            types::array<long, 1>{{n}}, T(0));
+      }
+      template <class B, class T>
+      typename std::enable_if<B::value == 2,
+                              types::ndarray<T, types::array<long, 2>>>::type
+      lstsq_solution(long n, long k)
+      {
+        return types::ndarray<T, types::array<long, 2>>(
+            types::array<long, 2>{{n, k}}, T(0));
+      }
+
+      template <class A, class B>
+      typename lstsq_type<A, B>::type lstsq(A const &a, B const &b,
+                                            double rcond)
+      {
+        static_assert(A::value == 2, "a is a matrix");
+        static_assert(B::value == 1 || B::value == 2,
+                      "b is a vector or a matrix");
+        using T = typename lstsq_type<A, B>::dtype;
+        using R = typename lstsq_type<A, B>::real;
+
+        auto const &aa = asarray(a);
+        auto const &bb = asarray(b);
+        long m = aa.template shape<0>(), n = aa.template shape<1>();
+        long k = B::value == 1 ? 1 : bb.flat_size() / m;
+        if (bb.template shape<0>() != m)
+          throw types::ValueError("Incompatible dimensions");
+
+        // the columns of a, stored contiguously, are made orthogonal
+        std::vector<T> w(m * n), v(n * n);
+        for (long i = 0; i < m; ++i)
+          for (long j = 0; j < n; ++j)
+            w[j * m + i] = aa.buffer[i * n + j];
+        utils::jacobi_svd(w.data(), m, n, v.data());
+
+        std::vector<R> sigma(n);
+        for (long j = 0; j < n; ++j) {
+          R s = 0;
+          for (long i = 0; i < m; ++i)
+            s += std::norm(w[j * m + i]);
+          sigma[j] = std::sqrt(s);
+        }
+        if (rcond < 0)
+          rcond = std::numeric_limits<R>::epsilon();
+        R cutoff =
+            n ? R(rcond) * *std::max_element(sigma.begin(), sigma.end()) : 0;
+
+        // x = v s^+ u^H b, with u s the columns of w
+        auto x = lstsq_solution<B, T>(n, k);
+        long rank = 0;
+        for (long j = 0; j < n; ++j) {
+          if (!(sigma[j] > cutoff))
+            continue;
+          ++rank;
+          T const *wj = w.data() + j * m;
+          T const *vj = v.data() + j * n;
+          for (long c = 0; c < k; ++c) {
+            T coef = T(0);
+            for (long i = 0; i < m; ++i)
+              coef +=
+                  utils::details::conjugate(wj[i]) * T(bb.buffer[i * k + c]);
+            coef /= sigma[j] * sigma[j];
+            for (long r = 0; r < n; ++r)
+              x.buffer[r * k + c] += vj[r] * coef;
+          }
+        }
+
+        long nres = rank == n && m > n ? k : 0;
+        types::ndarray<R, types::array<long, 1>> residuals(
+            types::array<long, 1>{{nres}}, R(0));
+        for (long c = 0; c < nres; ++c)
+          for (long i = 0; i < m; ++i) {
+            T e = T(bb.buffer[i * k + c]);
+            for (long r = 0; r < n; ++r)
+              e -= T(aa.buffer[i * n + r]) * x.buffer[r * k + c];
+            residuals.buffer[c] += std::norm(e);
+          }
+
+        std::sort(sigma.begin(), sigma.end(), std::greater<R>());
+        long ns = std::min(m, n);
+        types::ndarray<R, types::array<long, 1>> s(types::array<long, 1>{{ns}},
+                                                   builtins::None);
+        std::copy(sigma.begin(), sigma.begin() + ns, s.buffer);
+        return std::make_tuple(x, residuals, rank, s);
+      }
+    }
+
+    template <class A, class B>
+    typename details::lstsq_type<A, B>::type lstsq(A const &a, B const &b,
+                                                   types::none_type)
+    {
+      using R = typename details::lstsq_type<A, B>::real;
+      long m = a.template shape<0>(), n = a.template shape<1>();
+      return details::lstsq(a, b,
+                            std::numeric_limits<R>::epsilon() * std::max(m, n));
+    }
+
+    template <class A, class B>
+    typename details::lstsq_type<A, B>::type lstsq(A const &a, B const &b,
+                                                   double rcond)
+    {
+      return details::lstsq(a, b, rcond);
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
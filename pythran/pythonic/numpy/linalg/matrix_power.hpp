@@ -4,11 +4,15 @@
 #include "pythonic/include/numpy/linalg/matrix_power.hpp"
 
 #include "pythonic/numpy/array.hpp"
-#include "pythonic/numpy/asarray.hpp"
 #include "pythonic/numpy/identity.hpp"
 #include "pythonic/numpy/dot.hpp"
+#include "pythonic/utils/linalg.hpp"
 
 #include "pythonic/builtins/NotImplementedError.hpp"
+
+#include <algorithm>
+#include <utility>
+
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
@@ -17,28 +21,60 @@ namespace numpy
 
     namespace details
     {
+      /* Products of the binary exponentiation. Each of them is written into
+       * tmp, which is then swapped with its destination, so that no
+       * allocation takes place after the first step.
+       */
+      template <class A>
+      void square(A &p, A &tmp, utils::matrix_structure, long,
+                  std::false_type)
+      {
+        numpy::functor::dot{}(p, p, tmp);
+        std::swap(p, tmp);
+      }
 
-      template <class E>
-      E fast_pow(E const &base, long n)
+      template <class A>
+      void square(A &p, A &tmp, utils::matrix_structure s, long n,
+                  std::true_type)
       {
-        if (n == 1)
-          return base;
-        if (n == 2)
-          return numpy::functor::dot{}(base, base);
-        if (n == 3) {
-          auto tmp = numpy::functor::dot{}(base, base);
-          return numpy::functor::dot{}(tmp, base);
-        }
-        // starting from here, we know for sure that tmp will point to newly
-        // allocated memory
-        // this is used to optimize in-place dot computation in the odd case
-        auto tmp = fast_pow(base, n / 2);
-        if (n & 1) {
-          auto next = numpy::functor::dot{}(tmp, tmp);
-          return numpy::functor::dot{}(base, next, tmp);
-        } else {
-          return numpy::functor::dot{}(tmp, tmp);
+        switch (s) {
+        case utils::matrix_structure::symmetric:
+          utils::symmetric_square(p.buffer, n, tmp.buffer);
+          break;
+        case utils::matrix_structure::upper:
+        case utils::matrix_structure::lower:
+          std::copy(p.buffer, p.buffer + n * n, tmp.buffer);
+          utils::triangular_multiply(
+              true, s == utils::matrix_structure::upper, p.buffer, n,
+              tmp.buffer);
+          break;
+        default:
+          numpy::functor::dot{}(p, p, tmp);
         }
+        std::swap(p, tmp);
+      }
+
+      template <class A>
+      void multiply(A &r, A const &p, A &tmp, utils::matrix_structure, long,
+                    std::false_type)
+      {
+        numpy::functor::dot{}(r, p, tmp);
+        std::swap(r, tmp);
+      }
+
+      // Powers of a triangular matrix keep its structure, and those of a
+      // symmetric matrix commute, so that only the squarings benefit.
+      template <class A>
+      void multiply(A &r, A const &p, A &tmp, utils::matrix_structure s,
+                    long n, std::true_type)
+      {
+        if (s == utils::matrix_structure::upper ||
+            s == utils::matrix_structure::lower)
+          utils::triangular_multiply(
+              false, s == utils::matrix_structure::upper, p.buffer, n,
+              r.buffer);
+        else
+          multiply(r, p, tmp, s, n, std::false_type{});
       }
     }
 
@@ -46,14 +82,45 @@ namespace numpy
     auto matrix_power(E const &expr, long n)
         -> decltype(numpy::functor::array{}(expr))
     {
+      using result_type = decltype(numpy::functor::array{}(expr));
+      using dtype = typename result_type::dtype;
       if (n == 0)
         return numpy::functor::identity{}(expr.template shape<0>(),
                                           types::dtype_t<typename E::dtype>{});
-      if (n > 0) {
-        auto base = numpy::functor::asarray{}(expr);
-        return details::fast_pow(base, n);
+      if (n < 0)
+        throw pythonic::builtins::NotImplementedError("negative power");
+
+      result_type power = numpy::functor::array{}(expr);
+      long order;
+      utils::square_matrices(sutils::getshape(power), order);
+      if (n == 1)
+        return power;
+
+      std::integral_constant<bool, is_blas_type<dtype>::value> blas;
+      utils::matrix_structure structure =
+          blas ? utils::structure_of(power.buffer, order)
+               : utils::matrix_structure::general;
+      result_type result(power._shape, builtins::None),
+          tmp(power._shape, builtins::None);
+
+      // binary exponentiation, from the least significant bit
+      bool started = false;
+      for (; n; n >>= 1) {
+        if (n & 1) {
+          if (started)
+            details::multiply(result, power, tmp, structure, order, blas);
+          else if (n == 1)
+            return power;
+          else {
+            std::copy(power.buffer, power.buffer + order * order,
+                      result.buffer);
+            started = true;
+          }
+        }
+        if (n > 1)
+          details::square(power, tmp, structure, order, blas);
       }
-      throw pythonic::builtins::NotImplementedError("negative power");
+      return result;
     }
   }
 }
@@ -0,0 +1,79 @@
+#ifndef PYTHONIC_NUMPY_LINALG_SOLVE_HPP
+#define PYTHONIC_NUMPY_LINALG_SOLVE_HPP
+
+#include "pythonic/include/numpy/linalg/solve.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/linalg.hpp"
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace linalg
+  {
+    namespace details
+    {
+      template <class T, class SA, class SB, class N, class R>
+      long solve_kernel(SA const *a, SB const *b, N n, R nrhs, T *x)
+      {
+        utils::scratch<T> lu(n * n);
+        utils::scratch<long> piv(n);
+        std::copy(a, a + n * n, lu.data());
+        if (long info = utils::lu_factor(lu.data(), n, piv.data()))
+          return info;
+        std::copy(b, b + n * nrhs, x);
+        utils::lu_solve(lu.data(), n, piv.data(), x, nrhs);
+        return 0;
+      }
+    }
+
+    template <class A, class B>
+    types::ndarray<typename utils::linalg_type<typename __combined<
+                       typename A::dtype, typename B::dtype>::type>::type,
+                   types::array<long, B::value>>
+    solve(A const &a, B const &b)
+    {
+      static_assert(B::value == A::value || B::value + 1 == A::value,
+                    "b is a stack of vectors or of matrices");
+      using T = typename utils::linalg_type<typename __combined<
+          typename A::dtype, typename B::dtype>::type>::type;
+      constexpr bool vectors = B::value + 1 == A::value;
+
+      auto const &aa = asarray(a);
+      auto const &bb = asarray(b);
+      using order = utils::matrix_order_of<decltype(aa)>;
+      using rhs_order = typename std::conditional<
+          vectors, utils::matrix_order<std::integral_constant<long, 1>>,
+          utils::matrix_order_of<decltype(bb)>>::type;
+      auto ashape = sutils::getshape(aa);
+      auto bshape = sutils::getshape(bb);
+      long n;
+      long count = utils::square_matrices(ashape, n);
+      long nrhs = vectors ? 1 : bshape[B::value - 1];
+      if (!std::equal(ashape.begin(), ashape.end() - 2, bshape.begin()) ||
+          bshape[A::value - 2] != n)
+        throw types::ValueError("solve: Input operand 1 has a mismatch in its "
+                                "core dimension 0");
+
+      types::ndarray<T, types::array<long, B::value>> out(bshape,
+                                                          builtins::None);
+      auto const *asrc = aa.buffer;
+      auto const *bsrc = bb.buffer;
+      T *dst = out.buffer;
+      auto m = order::make(n);
+      auto r = rhs_order::make(nrhs);
+      if (utils::for_each_matrix(count, n * n * (n + nrhs), [&](long i) {
+            return details::solve_kernel(asrc + i * n * n, bsrc + i * n * nrhs,
+                                         m, r, dst + i * n * nrhs);
+          }))
+        throw types::ValueError("Singular matrix");
+      return out;
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef PYTHONIC_NUMPY_MATMUL_HPP
+#define PYTHONIC_NUMPY_MATMUL_HPP
+
+#include "pythonic/include/numpy/matmul.hpp"
+
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/dot.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/contract.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class F>
+  auto matmul(E const &e, F const &f) -> typename std::enable_if<
+      (E::value <= 2 && F::value <= 2), decltype(dot(e, f))>::type
+  {
+    return dot(e, f);
+  }
+
+  namespace details
+  {
+    template <class T, class A>
+    typename std::enable_if<std::is_same<T, typename A::dtype>::value,
+                            T const *>::type
+    matmul_buffer(A const &array, std::vector<T> &)
+    {
+      return array.buffer;
+    }
+    template <class T, class A>
+    typename std::enable_if<!std::is_same<T, typename A::dtype>::value,
+                            T const *>::type
+    matmul_buffer(A const &array, std::vector<T> &storage)
+    {
+      storage.assign(array.buffer, array.buffer + array.flat_size());
+      return storage.data();
+    }
+  }
+
+  template <class E, class F>
+  typename std::enable_if<
+      (E::value > 2 || F::value > 2),
+      types::ndarray<
+          typename __combined<typename E::dtype, typename F::dtype>::type,
+          types::array<long, details::matmul_rank<E::value,
+                                                  F::value>::value>>>::type
+  matmul(E const &e, F const &f)
+  {
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    constexpr long N0 = E::value, N1 = F::value;
+    using rank = details::matmul_rank<N0, N1>;
+    constexpr long NB = rank::value - (N0 >= 2) - (N1 >= 2);
+
+    auto const &a = asarray(e);
+    auto const &b = asarray(f);
+    auto ashape = sutils::getshape(a);
+    auto bshape = sutils::getshape(b);
+
+    // vectors are promoted to matrices, and the extra axis is dropped
+    long m = N0 >= 2 ? ashape[N0 - 2] : 1, k = ashape[N0 - 1];
+    long n = N1 >= 2 ? bshape[N1 - 1] : 1, k1 = bshape[N1 >= 2 ? N1 - 2 : 0];
+    if (k != k1)
+      throw types::ValueError("matmul: Input operand 1 has a mismatch in its "
+                              "core dimension 0");
+
+    // broadcast batch dimensions, right-aligned, and the number of matrices
+    // between consecutive indices along each of them
+    types::array<long, rank::value> shape;
+    long astrides[NB + 1], bstrides[NB + 1];
+    for (long d = NB - 1, sa = 1, sb = 1; d >= 0; --d) {
+      long da = d - (NB - (long)rank::batch0);
+      long db = d - (NB - (long)rank::batch1);
+      long na = da >= 0 ? ashape[da] : 1, nb = db >= 0 ? bshape[db] : 1;
+      if (na != nb && na != 1 && nb != 1)
+        throw types::ValueError("operands could not be broadcast together");
+      shape[d] = std::max(na, nb);
+      astrides[d] = na == 1 ? 0 : sa;
+      bstrides[d] = nb == 1 ? 0 : sb;
+      sa *= na;
+      sb *= nb;
+    }
+    long nbatch = 1;
+    for (long d = 0; d < NB; ++d)
+      nbatch *= shape[d];
+    if (N0 >= 2)
+      shape[NB] = m;
+    if (N1 >= 2)
+      shape[rank::value - 1] = n;
+
+    std::vector<T> astorage, bstorage;
+    T const *A = details::matmul_buffer(a, astorage);
+    T const *B = details::matmul_buffer(b, bstorage);
+    types::ndarray<T, types::array<long, rank::value>> out(shape,
+                                                           builtins::None);
+    T *C = out.buffer;
+#ifdef _OPENMP
+#pragma omp parallel for if (nbatch > 1 &&                                     \
+                             nbatch * m * n * k >=                             \
+                                 PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long i = 0; i < nbatch; ++i) {
+      long ia = 0, ib = 0;
+      for (long d = NB - 1, r = i; d >= 0; r /= shape[d--]) {
+        ia += (r % shape[d]) * astrides[d];
+        ib += (r % shape[d]) * bstrides[d];
+      }
+      utils::gemm(false, false, m, n, k, A + ia * m * k, B + ib * k * n,
+                  C + i * m * n);
+    }
+    return out;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -6,78 +6,18 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
-#include "pythonic/numpy/sort.hpp"
-#include <algorithm>
-#include <memory>
+#include "pythonic/numpy/quantile.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-  namespace
-  {
-
-    template <class T_out, class T, class pS>
-    typename std::enable_if<std::tuple_size<pS>::value != 1, void>::type
-    _median(T_out *out, types::ndarray<T, pS> const &tmp, long axis)
-    {
-      auto tmp_shape = sutils::getshape(tmp);
-      const long step =
-          std::accumulate(tmp_shape.begin() + axis, tmp_shape.end(), 1L,
-                          std::multiplies<long>());
-      long const buffer_size = tmp_shape[axis];
-      std::unique_ptr<T[]> buffer{new T[buffer_size]};
-      const long stepper = step / tmp_shape[axis];
-      const long n = tmp.flat_size() / tmp_shape[axis] * step;
-      long ith = 0, nth = 0;
-      for (long i = 0; i < n; i += step) {
-        T *buffer_iter = buffer.get();
-        T const *iter = tmp.buffer + ith;
-        T const *iend = iter + step;
-        while (iter != iend) {
-          *buffer_iter++ = *iter;
-          iter += stepper;
-        }
-        if (buffer_size % 2 == 1) {
-          std::nth_element(buffer.get(), buffer.get() + buffer_size / 2,
-                           buffer_iter, comparator<T>{});
-          *out++ = buffer[buffer_size / 2];
-        } else {
-          std::nth_element(buffer.get(), buffer.get() + buffer_size / 2,
-                           buffer_iter, comparator<T>{});
-          auto t0 = buffer[buffer_size / 2];
-          std::nth_element(buffer.get(), buffer.get() + buffer_size / 2 - 1,
-                           buffer.get() + buffer_size / 2, comparator<T>{});
-          auto t1 = buffer[buffer_size / 2 - 1];
-          *out++ = (t0 + t1) / double(2);
-        }
-        ith += step;
-        if (ith - nth == tmp.flat_size()) {
-          ++nth;
-          ith = nth;
-        }
-      }
-    }
-  }
-
   template <class T, class pS>
   decltype(std::declval<T>() + 1.) median(types::ndarray<T, pS> const &arr,
                                           types::none_type)
   {
-    size_t n = arr.flat_size();
-    std::unique_ptr<T[]> tmp{new T[n]};
-    std::copy(arr.buffer, arr.buffer + n, tmp.get());
-    std::nth_element(tmp.get(), tmp.get() + n / 2, tmp.get() + n,
-                     comparator<T>{});
-    T t0 = tmp[n / 2];
-    if (n % 2 == 1) {
-      return t0;
-    } else {
-      std::nth_element(tmp.get(), tmp.get() + n / 2 - 1, tmp.get() + n / 2,
-                       comparator<T>{});
-      T t1 = tmp[n / 2 - 1];
-      return (t0 + t1) / 2.;
-    }
+    return details::quantile<decltype(std::declval<T>() + 1.)>(
+        arr, 0.5, types::none_type{}, 1., false, "");
   }
 
   template <class T, class pS>
@@ -87,20 +27,10 @@ namespace numpy
                      types::array<long, std::tuple_size<pS>::value - 1>>>::type
   median(types::ndarray<T, pS> const &arr, long axis)
   {
-    constexpr auto N = std::tuple_size<pS>::value;
-    if (axis < 0)
-      axis += N;
-
-    types::array<long, std::tuple_size<pS>::value - 1> shp;
-    auto stmp = sutils::getshape(arr);
-    auto next = std::copy(stmp.begin(), stmp.begin() + axis, shp.begin());
-    std::copy(stmp.begin() + axis + 1, stmp.end(), next);
-
-    types::ndarray<decltype(std::declval<T>() + 1.),
-                   types::array<long, std::tuple_size<pS>::value - 1>>
-        out(shp, types::none_type{});
-    _median(out.buffer, arr, axis);
-    return out;
+    return details::quantile<types::ndarray<
+        decltype(std::declval<T>() + 1.),
+        types::array<long, std::tuple_size<pS>::value - 1>>>(arr, 0.5, axis,
+                                                             1., false, "");
   }
 
   template <class T, class pS>
@@ -0,0 +1,32 @@
+#ifndef PYTHONIC_NUMPY_NANPERCENTILE_HPP
+#define PYTHONIC_NUMPY_NANPERCENTILE_HPP
+
+#include "pythonic/include/numpy/nanpercentile.hpp"
+
+#include "pythonic/numpy/quantile.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, types::none_type>::type
+  nanpercentile(E const &a, Q const &q, types::none_type axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, types::none_type>::type>(
+        a, q, axis, 100., true, "Percentiles must be in the range [0, 100]");
+  }
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, long>::type
+  nanpercentile(E const &a, Q const &q, long axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, long>::type>(
+        a, q, axis, 100., true, "Percentiles must be in the range [0, 100]");
+  }
+}
+PYTHONIC_NS_END
+
+#endif
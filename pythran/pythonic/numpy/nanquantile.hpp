@@ -0,0 +1,32 @@
+#ifndef PYTHONIC_NUMPY_NANQUANTILE_HPP
+#define PYTHONIC_NUMPY_NANQUANTILE_HPP
+
+#include "pythonic/include/numpy/nanquantile.hpp"
+
+#include "pythonic/numpy/quantile.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, types::none_type>::type
+  nanquantile(E const &a, Q const &q, types::none_type axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, types::none_type>::type>(
+        a, q, axis, 1., true, "Quantiles must be in the range [0, 1]");
+  }
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, long>::type
+  nanquantile(E const &a, Q const &q, long axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, long>::type>(
+        a, q, axis, 1., true, "Quantiles must be in the range [0, 1]");
+  }
+}
+PYTHONIC_NS_END
+
+#endif
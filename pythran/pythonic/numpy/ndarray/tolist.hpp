@@ -4,9 +4,12 @@
 #include "pythonic/include/numpy/ndarray/tolist.hpp"
 
 #include "pythonic/utils/functor.hpp"
-#include "pythonic/utils/numpy_conversion.hpp"
+#include "pythonic/utils/stream.hpp"
 #include "pythonic/types/ndarray.hpp"
 
+#include <functional>
+#include <numeric>
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
@@ -15,27 +18,72 @@ namespace numpy
   namespace ndarray
   {
 
-    template <class T, class pS>
-    typename std::enable_if<std::tuple_size<pS>::value == 1,
-                            types::list<T>>::type
-    tolist(types::ndarray<T, pS> const &expr)
+    namespace details
     {
-      return {expr.fbegin(), expr.fend()};
+      template <class T>
+      types::list<T> tolist(T const *data, long const *shape, utils::int_<1>)
+      {
+        return types::list<T>(data, data + shape[0]);
+      }
+
+      /* Rows are built straight from the buffer and stored in a list of the
+       * right size, rather than appended one after the other. */
+      template <class T, size_t N>
+      typename tolist_type<T, N>::type tolist(T const *data, long const *shape,
+                                              utils::int_<N>)
+      {
+        long n = shape[0];
+        long stride = std::accumulate(shape + 1, shape + N, 1L,
+                                      std::multiplies<long>());
+        typename tolist_type<T, N>::type out(n);
+        for (long i = 0; i < n; ++i)
+          out.fast(i) =
+              tolist(data + i * stride, shape + 1, utils::int_<N - 1>());
+        return out;
+      }
+
+      template <class E>
+      types::list<typename E::dtype> tolist(E const &expr, utils::int_<1>)
+      {
+        types::list<typename E::dtype> out(expr.template shape<0>());
+        auto iter = out.begin();
+        utils::stream_blocks(expr,
+                             [&iter](typename E::dtype const *data, long n) {
+                               iter = std::copy(data, data + n, iter);
+                             });
+        return out;
+      }
+
+      template <class E, size_t N>
+      typename tolist_type<typename E::dtype, N>::type tolist(E const &expr,
+                                                              utils::int_<N>)
+      {
+        typename tolist_type<typename E::dtype, N>::type out(
+            expr.template shape<0>());
+        long i = 0;
+        for (auto &&row : expr)
+          out.fast(i++) = tolist(row, utils::int_<N - 1>());
+        return out;
+      }
     }
 
     template <class T, class pS>
-    typename std::enable_if<
-        std::tuple_size<pS>::value != 1,
-        typename tolist_type<T, std::tuple_size<pS>::value>::type>::type
+    typename tolist_type<T, std::tuple_size<pS>::value>::type
     tolist(types::ndarray<T, pS> const &expr)
     {
-      typename tolist_type<T, std::tuple_size<pS>::value>::type out(0);
-      for (auto const &elts : expr)
-        out.push_back(tolist(elts));
-      return out;
+      auto const shape = sutils::getshape(expr);
+      return details::tolist(expr.buffer, shape.data(),
+                             utils::int_<std::tuple_size<pS>::value>());
     }
 
-    NUMPY_EXPR_TO_NDARRAY0_IMPL(tolist);
+    template <class E>
+    typename std::enable_if<
+        !types::is_ndarray<E>::value && types::is_array<E>::value,
+        typename tolist_type<typename E::dtype, E::value>::type>::type
+    tolist(E const &expr)
+    {
+      return details::tolist(expr, utils::int_<E::value>());
+    }
   }
 }
 PYTHONIC_NS_END
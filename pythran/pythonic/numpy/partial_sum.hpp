@@ -3,8 +3,11 @@
 
 #include "pythonic/include/numpy/partial_sum.hpp"
 
+#include "pythonic/numpy/asarray.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/builtins/None.hpp"
 #include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/scan.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -12,7 +15,8 @@ namespace numpy
 {
 
   /**
-   * The cast is perform to be numpy compliant
+   * Each element is cast to the output type before being accumulated, to
+   * be numpy compliant
    *
    * a = numpy.array([1, 256])
    * In [10]: numpy.mod.accumulate(a, dtype=numpy.uint32)
@@ -20,67 +24,16 @@ namespace numpy
    * In [11]: numpy.mod.accumulate(a, dtype=numpy.uint8)
    * Out[11]: array([1, 0], dtype=uint8)
    */
-  namespace
-  {
-
-    template <class Op, size_t N, class A>
-    struct _partial_sum {
-      template <class E, class F>
-      A operator()(E const &e, F &o)
-      {
-        auto it_begin = e.begin();
-        A acc = _partial_sum<Op, N - 1, A>{}((*it_begin), o);
-        ++it_begin;
-        for (; it_begin < e.end(); ++it_begin)
-          acc = _partial_sum<Op, N - 1, A>{}(*it_begin, o, acc);
-        return acc;
-      }
-      template <class E, class F>
-      A operator()(E const &e, F &o, A acc)
-      {
-        for (auto const &value : e)
-          acc = _partial_sum<Op, N - 1, A>{}(value, o, acc);
-        return acc;
-      }
-    };
-
-    template <class Op, class A>
-    struct _partial_sum<Op, 1, A> {
-      template <class E, class F>
-      A operator()(E const &e, F &o)
-      {
-        auto it_begin = e.begin();
-        A acc = *it_begin;
-        *o = acc;
-        ++it_begin, ++o;
-        for (; it_begin < e.end(); ++it_begin, ++o) {
-          acc = Op{}(acc, (A)*it_begin);
-          *o = acc;
-        }
-        return acc;
-      }
-      template <class E, class F>
-      A operator()(E e, F &o, A acc)
-      {
-        for (auto const &value : e) {
-          acc = Op{}(acc, (A)value);
-          *o = acc;
-          ++o;
-        }
-        return acc;
-      }
-    };
-  }
 
   template <class Op, class E, class dtype>
   types::ndarray<typename dtype::type, types::pshape<long>>
   partial_sum(E const &expr, dtype d)
   {
-    const long count = expr.flat_size();
+    auto const &arr = asarray(expr);
+    const long count = arr.flat_size();
     types::ndarray<typename dtype::type, types::pshape<long>> the_partial_sum{
         types::make_tuple(count), builtins::None};
-    auto begin_it = the_partial_sum.begin();
-    _partial_sum<Op, E::value, typename dtype::type>{}(expr, begin_it);
+    utils::inclusive_scan<Op>(arr.buffer, the_partial_sum.buffer, count);
     return the_partial_sum;
   }
 
@@ -91,7 +44,7 @@ namespace numpy
   {
     if (axis != 0)
       throw types::ValueError("axis out of bounds");
-    return partial_sum<Op, E, dtype>(expr);
+    return partial_sum<Op, E, dtype>(expr, d);
   }
 
   template <class Op, class E, class dtype>
@@ -101,18 +54,17 @@ namespace numpy
     if (axis < 0 || size_t(axis) >= E::value)
       throw types::ValueError("axis out of bounds");
 
-    auto shape = sutils::getshape(expr);
+    auto const &arr = asarray(expr);
+    auto shape = sutils::getshape(arr);
+    long outer = 1, inner = 1;
+    for (long i = 0; i < axis; ++i)
+      outer *= shape[i];
+    for (long i = axis + 1; i < (long)E::value; ++i)
+      inner *= shape[i];
+
     partial_sum_type<Op, E, dtype> the_partial_sum{shape, builtins::None};
-    if (axis == 0) {
-      auto it_begin = the_partial_sum.begin();
-      _partial_sum<Op, 1, partial_sum_type2<Op, E, dtype>>{}(expr, it_begin);
-    } else {
-      std::transform(
-          expr.begin(), expr.end(), the_partial_sum.begin(),
-          [axis, d](
-              typename std::iterator_traits<typename E::iterator>::value_type
-                  other) { return partial_sum<Op>(other, axis - 1, d); });
-    }
+    utils::inclusive_scan_axis<Op>(arr.buffer, the_partial_sum.buffer, outer,
+                                   (long)shape[axis], inner);
     return the_partial_sum;
   }
 }
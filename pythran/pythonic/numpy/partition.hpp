@@ -0,0 +1,100 @@
+#ifndef PYTHONIC_NUMPY_PARTITION_HPP
+#define PYTHONIC_NUMPY_PARTITION_HPP
+
+#include "pythonic/include/numpy/partition.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/array.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/select.hpp"
+
+#include <algorithm>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value>::type
+    partition_kth(K k, std::vector<long> &ks)
+    {
+      ks.push_back(k);
+    }
+    template <class K>
+    typename std::enable_if<!std::is_integral<K>::value>::type
+    partition_kth(K const &kth, std::vector<long> &ks)
+    {
+      for (long k : kth)
+        ks.push_back(k);
+    }
+
+    // sorted, non-negative positions to select in lanes of n elements
+    template <class K>
+    std::vector<long> partition_kth(K const &kth, long n)
+    {
+      std::vector<long> ks;
+      partition_kth(kth, ks);
+      for (long &k : ks) {
+        if (k < 0)
+          k += n;
+        if (k < 0 || k >= n)
+          throw types::ValueError("kth out of bounds");
+      }
+      std::sort(ks.begin(), ks.end());
+      ks.erase(std::unique(ks.begin(), ks.end()), ks.end());
+      return ks;
+    }
+
+    template <size_t N>
+    long partition_axis(long axis)
+    {
+      if (axis < 0)
+        axis += N;
+      if (axis < 0 || axis >= (long)N)
+        throw types::ValueError("axis out of bounds");
+      return axis;
+    }
+  }
+
+  template <class E, class K>
+  types::ndarray<typename E::dtype, types::array<long, E::value>>
+  partition(E const &a, K const &kth, long axis)
+  {
+    using T = typename E::dtype;
+    auto out = functor::array{}(a);
+    axis = details::partition_axis<E::value>(axis);
+    long outer, n, inner;
+    utils::split_lanes(sutils::getshape(out), axis, outer, n, inner);
+    std::vector<long> ks = details::partition_kth(kth, n);
+
+    T *data = out.buffer;
+    utils::for_each_lane<T>(
+        outer, n, inner, [&](long, long offset, T *buffer) {
+          T *lane = data + offset;
+          if (inner == 1) {
+            utils::select(lane, lane + n, ks.begin(), ks.end());
+            return;
+          }
+          for (long j = 0; j < n; ++j)
+            buffer[j] = lane[j * inner];
+          utils::select(buffer, buffer + n, ks.begin(), ks.end());
+          for (long j = 0; j < n; ++j)
+            lane[j * inner] = buffer[j];
+        });
+    return out;
+  }
+
+  template <class E, class K>
+  types::ndarray<typename E::dtype, types::array<long, 1>>
+  partition(E const &a, K const &kth, types::none_type)
+  {
+    return partition(functor::array{}(a).flat(), kth, 0L);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef PYTHONIC_NUMPY_QUANTILE_HPP
+#define PYTHONIC_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/numpy/quantile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/select.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class Q>
+    typename std::enable_if<std::is_arithmetic<Q>::value>::type
+    quantile_values(Q q, std::vector<double> &qs)
+    {
+      qs.push_back(q);
+    }
+    template <class Q>
+    typename std::enable_if<!std::is_arithmetic<Q>::value>::type
+    quantile_values(Q const &q, std::vector<double> &qs)
+    {
+      for (auto v : q)
+        qs.push_back(v);
+    }
+
+    template <class A>
+    void quantile_lanes(A const &arr, types::none_type, long &outer, long &n,
+                        long &inner, std::vector<long> &)
+    {
+      outer = inner = 1;
+      n = arr.flat_size();
+    }
+    template <class A>
+    void quantile_lanes(A const &arr, long axis, long &outer, long &n,
+                        long &inner, std::vector<long> &dims)
+    {
+      constexpr long N = A::value;
+      if (axis < 0)
+        axis += N;
+      if (axis < 0 || axis >= N)
+        throw types::ValueError("axis out of bounds");
+      auto shape = sutils::getshape(arr);
+      utils::split_lanes(shape, axis, outer, n, inner);
+      for (long d = 0; d < N; ++d)
+        if (d != axis)
+          dims.push_back(shape[d]);
+    }
+
+    template <class D>
+    D quantile_output(types::ndarray<D, types::array<long, 1>> const &flat,
+                      std::vector<long> const &, D *)
+    {
+      return flat.buffer[0];
+    }
+    template <class D, size_t M>
+    types::ndarray<D, types::array<long, M>>
+    quantile_output(types::ndarray<D, types::array<long, 1>> const &flat,
+                    std::vector<long> const &dims,
+                    types::ndarray<D, types::array<long, M>> *)
+    {
+      types::array<long, M> shape;
+      std::copy(dims.begin(), dims.end(), shape.begin());
+      return flat.reshape(shape);
+    }
+
+    /* Quantiles q / scale of expr, all of them being computed from a single
+     * partial sort of each lane along axis.
+     */
+    template <class R, class E, class Q, class Axis>
+    R quantile(E const &expr, Q const &q, Axis axis, double scale,
+               bool skipnan, char const *range_error)
+    {
+      using T = typename E::dtype;
+      using D = decltype(std::declval<T>() + 1.);
+
+      std::vector<double> qs;
+      quantile_values(q, qs);
+      for (double &v : qs) {
+        v /= scale;
+        if (!(0 <= v && v <= 1))
+          throw types::ValueError(range_error);
+      }
+      std::vector<long> order(qs.size());
+      std::iota(order.begin(), order.end(), 0L);
+      std::sort(order.begin(), order.end(),
+                [&](long i, long j) { return qs[i] < qs[j]; });
+
+      std::vector<long> dims;
+      if (!std::is_arithmetic<Q>::value)
+        dims.push_back(qs.size());
+      auto const &arr = asarray(expr);
+      long outer, n, inner;
+      quantile_lanes(arr, axis, outer, n, inner, dims);
+
+      long nlanes = outer * inner, nq = qs.size();
+      types::ndarray<D, types::array<long, 1>> flat(
+          types::array<long, 1>{{nq * nlanes}}, builtins::None);
+      T const *data = arr.buffer;
+      D *out = flat.buffer;
+      utils::for_each_lane<T>(
+          outer, n, inner, [&](long lane, long offset, T *buffer) {
+            for (long j = 0; j < n; ++j)
+              buffer[j] = data[offset + j * inner];
+            utils::quantiles(buffer, n, qs.data(), order.data(), nq, skipnan,
+                             out + lane, nlanes);
+          });
+      return quantile_output(flat, dims, (R *)nullptr);
+    }
+  }
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, types::none_type>::type
+  quantile(E const &a, Q const &q, types::none_type axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, types::none_type>::type>(
+        a, q, axis, 1., false, "Quantiles must be in the range [0, 1]");
+  }
+
+  template <class E, class Q>
+  typename details::quantile_result<E, Q, long>::type
+  quantile(E const &a, Q const &q, long axis)
+  {
+    return details::quantile<
+        typename details::quantile_result<E, Q, long>::type>(
+        a, q, axis, 1., false, "Quantiles must be in the range [0, 1]");
+  }
+}
+PYTHONIC_NS_END
+
+#endif
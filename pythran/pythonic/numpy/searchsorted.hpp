@@ -6,11 +6,13 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
 #include "pythonic/utils/int_.hpp"
+#include "pythonic/utils/searchsorted.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/str.hpp"
 #include "pythonic/builtins/None.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/utils/stream.hpp"
 
 #include <algorithm>
 
@@ -19,39 +21,55 @@ PYTHONIC_NS_BEGIN
 namespace numpy
 {
 
-  template <class T, class U>
-  typename std::enable_if<!types::is_numexpr_arg<T>::value, long>::type
-  searchsorted(U const &a, T const &v, types::str const &side)
-  {
-    if (side[0] == "l")
-      return std::lower_bound(a.begin(), a.end(), v) - a.begin();
-    else if (side[0] == "r")
-      return std::upper_bound(a.begin(), a.end(), v) - a.begin();
-    else
-      throw types::ValueError("'" + side +
-                              "' is an invalid value for keyword 'side'");
-  }
-
   namespace
   {
-    template <class E, class I0, class I1>
-    void _search_sorted(E const &a, I0 ibegin, I0 iend, I1 obegin,
-                        types::str const &side, utils::int_<1>)
+    bool _search_right(types::str const &side)
+    {
+      if (side[0] == "l")
+        return false;
+      else if (side[0] == "r")
+        return true;
+      else
+        throw types::ValueError("'" + side +
+                                "' is an invalid value for keyword 'side'");
+    }
+
+    template <class Before, class A, class T, class pS, class O>
+    void _search_keys(Before before, A const &arr,
+                      types::ndarray<T, pS> const &keys, O &out)
     {
-      for (; ibegin != iend; ++ibegin, ++obegin)
-        *obegin = searchsorted(a, *ibegin, side);
+      utils::search_sorted(before, arr.buffer, arr.flat_size(), keys.buffer,
+                           keys.flat_size(), out.buffer);
     }
 
-    template <class E, class I0, class I1, size_t N>
-    void _search_sorted(E const &a, I0 ibegin, I0 iend, I1 obegin,
-                        types::str const &side, utils::int_<N>)
+    // keys expressions are searched block by block, as they are evaluated
+    template <class Before, class A, class E, class O>
+    void _search_keys(Before before, A const &arr, E const &keys, O &out)
     {
-      for (; ibegin != iend; ++ibegin, ++obegin)
-        _search_sorted(a, (*ibegin).begin(), (*ibegin).end(), (*obegin).begin(),
-                       side, utils::int_<N - 1>());
+      utils::sorted_searcher<Before, typename A::dtype> searcher(
+          before, arr.buffer, arr.flat_size(), out.flat_size());
+      long *iter = out.buffer;
+      utils::stream_blocks(
+          keys, [&searcher, &iter](typename E::dtype const *data, long n) {
+            searcher(data, n, iter);
+            iter += n;
+          });
     }
   }
 
+  template <class T, class U>
+  typename std::enable_if<!types::is_numexpr_arg<T>::value, long>::type
+  searchsorted(U const &a, T const &v, types::str const &side)
+  {
+    auto const &arr = asarray(a);
+    if (_search_right(side))
+      return utils::search_sorted(utils::search_right{}, arr.buffer,
+                                  arr.flat_size(), v);
+    else
+      return utils::search_sorted(utils::search_left{}, arr.buffer,
+                                  arr.flat_size(), v);
+  }
+
   template <class E, class T>
   typename std::enable_if<
       types::is_numexpr_arg<E>::value,
@@ -61,10 +79,13 @@ namespace numpy
     static_assert(T::value == 1,
                   "Not Implemented : searchsorted for dimension != 1");
 
-    types::ndarray<long, types::array<long, E::value>> out(asarray(v)._shape,
-                                                           builtins::None);
-    _search_sorted(a, v.begin(), v.end(), out.begin(), side,
-                   utils::int_<E::value>());
+    auto const &arr = asarray(a);
+    types::ndarray<long, types::array<long, E::value>> out(
+        sutils::getshape(v), builtins::None);
+    if (_search_right(side))
+      _search_keys(utils::search_right{}, arr, v, out);
+    else
+      _search_keys(utils::search_left{}, arr, v, out);
     return out;
   }
 }
@@ -3,8 +3,8 @@
 
 #include "pythonic/include/numpy/select.hpp"
 
+#include "pythonic/numpy/asarray.hpp"
 #include "pythonic/utils/functor.hpp"
-#include "pythonic/utils/int_.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -12,37 +12,14 @@ namespace numpy
 {
   namespace
   {
-    // TODO It could certainly be represent as a numpy_***_expr as each
-    // elements
-    // is computed without information from neighbor.
-    //
-    template <class Ichoice, class Icond, class Iout, class Isel>
-    long _select(Ichoice ibegin, Ichoice iend, Iout obegin, Isel sbegin,
-                 Icond cbegin, long size, utils::int_<1>)
+    /* Choices are blended in reverse order so that the first matching
+     * condition wins, through a branch-free loop the compiler vectorizes.
+     */
+    template <class T, class U, class V>
+    void _select(T *out, U const *cond, V const *choice, long n)
     {
-      static_assert(std::is_same<Ichoice, int>::value, "");
-      for (; ibegin != iend && size != 0;
-           ++ibegin, ++obegin, ++sbegin, ++cbegin) {
-        // If elements it not already selected && condition match, copy it!
-        if (!*sbegin && *cbegin) {
-          *obegin = *ibegin;
-          *sbegin = true;
-          size--;
-        }
-      }
-      return size;
-    }
-
-    template <class Ichoice, class Icond, class Iout, class Isel, size_t N>
-    long _select(Ichoice ibegin, Ichoice iend, Iout obegin, Isel sbegin,
-                 Icond cbegin, long size, utils::int_<N>)
-    {
-      for (; ibegin != iend && size != 0;
-           ++ibegin, ++obegin, ++sbegin, ++cbegin)
-        size = _select((*ibegin).begin(), (*ibegin).end(), (*obegin).begin(),
-                       (*sbegin).begin(), (*cbegin).begin(), size,
-                       utils::int_<N - 1>());
-      return size;
+      for (long i = 0; i < n; ++i)
+        out[i] = cond[i] ? static_cast<T>(choice[i]) : out[i];
     }
   }
 
@@ -51,16 +28,13 @@ namespace numpy
   select(C const &condlist, L const &choicelist, typename L::dtype _default)
   {
     constexpr size_t N = L::value - 1;
-    auto &&choicelist0_shape = sutils::getshape(choicelist[0]);
     types::ndarray<typename L::dtype, types::array<long, N>> out(
-        choicelist0_shape, _default);
-    types::ndarray<typename L::dtype, types::array<long, N>> selected(
-        choicelist0_shape, false);
-    long size = selected.flat_size();
-    for (long i = 0; i < condlist.size() && size != 0; i++)
-      size =
-          _select(choicelist[i].begin(), choicelist[i].end(), out.begin(),
-                  selected.begin(), condlist.begin(), size, utils::int_<N>());
+        sutils::getshape(choicelist[0]), _default);
+    for (long i = condlist.size(); i-- > 0;) {
+      auto const &cond = asarray(condlist[i]);
+      auto const &choice = asarray(choicelist[i]);
+      _select(out.buffer, cond.buffer, choice.buffer, out.flat_size());
+    }
     return out;
   }
 
@@ -70,19 +44,16 @@ namespace numpy
   {
     types::ndarray<typename L::dtype, sutils::pop_head_t<typename L::shape_t>>
         out(sutils::getshape(choicelist[0]), _default);
-    for (long i = 0; i < out.flat_size(); ++i)
-      for (long j = 0; j < condlist.size(); ++j)
-        if (condlist[j].buffer[i]) {
-          out.buffer[i] = choicelist[j].buffer[i];
-          break;
-        }
+    for (long j = condlist.size(); j-- > 0;)
+      _select(out.buffer, condlist[j].buffer, choicelist[j].buffer,
+              out.flat_size());
     return out;
   }
 
   template <class T, class TpS, class U, class UpS>
-  typename std::enable_if<std::tuple_size<TpS>::value ==
-                              std::tuple_size<UpS>::value,
-                          types::ndarray<T, TpS>>::type
+  typename std::enable_if<
+      std::tuple_size<TpS>::value == std::tuple_size<UpS>::value,
+      types::ndarray<T, types::array<long, std::tuple_size<TpS>::value>>>::type
   select(types::list<types::ndarray<U, UpS>> const &condlist,
          types::list<types::ndarray<T, TpS>> const &choicelist, T _default)
   {
@@ -112,6 +112,20 @@ namespace numpy
         }
       }
     }
+
+    template <class T, class pS>
+    void _sort_kind(types::ndarray<T, pS> &out, long axis,
+                    types::str const &kind)
+    {
+      if (kind == "quicksort")
+        _sort(out, axis, quicksorter());
+      else if (kind == "mergesort")
+        _sort(out, axis, mergesorter());
+      else if (kind == "heapsort")
+        _sort(out, axis, heapsorter());
+      else if (kind == "stable")
+        _sort(out, axis, stablesorter());
+    }
   }
 
   template <class E>
@@ -137,14 +151,38 @@ namespace numpy
   sort(E const &expr, long axis, types::str const &kind)
   {
     auto out = functor::array{}(expr);
-    if (kind == "quicksort")
-      _sort(out, axis, quicksorter());
-    else if (kind == "mergesort")
-      _sort(out, axis, mergesorter());
-    else if (kind == "heapsort")
-      _sort(out, axis, heapsorter());
-    else if (kind == "stable")
-      _sort(out, axis, stablesorter());
+    _sort_kind(out, axis, kind);
+    return out;
+  }
+
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, 1>> sort(types::ndarray<T, pS> &&arr,
+                                                types::none_type)
+  {
+    auto tmp = functor::array{}(std::move(arr));
+    long n = tmp.flat_size();
+    auto out = std::move(tmp).reshape(types::array<long, 1>{{n}});
+    _sort(out, 0, quicksorter());
+    return out;
+  }
+
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, std::tuple_size<pS>::value>>
+  sort(types::ndarray<T, pS> &&arr, long axis)
+  {
+    types::ndarray<T, types::array<long, std::tuple_size<pS>::value>> out =
+        functor::array{}(std::move(arr));
+    _sort(out, axis, quicksorter());
+    return out;
+  }
+
+  template <class T, class pS>
+  types::ndarray<T, types::array<long, std::tuple_size<pS>::value>>
+  sort(types::ndarray<T, pS> &&arr, long axis, types::str const &kind)
+  {
+    types::ndarray<T, types::array<long, std::tuple_size<pS>::value>> out =
+        functor::array{}(std::move(arr));
+    _sort_kind(out, axis, kind);
     return out;
   }
 
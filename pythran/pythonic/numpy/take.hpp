@@ -9,7 +9,7 @@ namespace numpy
 {
   template <class F, class T>
   auto take(T &&expr, F &&indices)
-      -> decltype(std::forward<T>(expr)[std::forward<T>(indices)])
+      -> decltype(std::forward<T>(expr)[std::forward<F>(indices)])
   {
     return expr[indices];
   }
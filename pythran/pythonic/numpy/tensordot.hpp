@@ -0,0 +1,101 @@
+#ifndef PYTHONIC_NUMPY_TENSORDOT_HPP
+#define PYTHONIC_NUMPY_TENSORDOT_HPP
+
+#include "pythonic/include/numpy/tensordot.hpp"
+
+#include "pythonic/numpy/einsum.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class I>
+    typename std::enable_if<std::is_integral<I>::value>::type
+    tensordot_axis_list(I axis, long n, std::vector<long> &out)
+    {
+      out.push_back(axis < 0 ? axis + n : axis);
+    }
+    template <class S>
+    typename std::enable_if<!std::is_integral<S>::value>::type
+    tensordot_axis_list(S const &axes, long n, std::vector<long> &out)
+    {
+      for (long axis : axes)
+        tensordot_axis_list(axis, n, out);
+    }
+
+    template <long N>
+    void tensordot_axes(std::integral_constant<long, N>, long na, long,
+                        std::vector<long> &aaxes, std::vector<long> &baxes)
+    {
+      for (long i = 0; i < N; ++i) {
+        aaxes.push_back(na - N + i);
+        baxes.push_back(i);
+      }
+    }
+    template <class Axes>
+    void tensordot_axes(Axes const &axes, long na, long nb,
+                        std::vector<long> &aaxes, std::vector<long> &baxes)
+    {
+      tensordot_axis_list(std::get<0>(axes), na, aaxes);
+      tensordot_axis_list(std::get<1>(axes), nb, baxes);
+    }
+  }
+
+  template <class A, class B, class Axes>
+  typename details::einsum_result<
+      A::value + B::value - 2 * details::tensordot_naxes<Axes>::value,
+      typename __combined<typename A::dtype, typename B::dtype>::type>::type
+  tensordot(A const &a, B const &b, Axes const &axes)
+  {
+    using T = typename __combined<typename A::dtype, typename B::dtype>::type;
+    constexpr long N0 = A::value, N1 = B::value;
+    std::vector<long> aaxes, baxes;
+    details::tensordot_axes(axes, N0, N1, aaxes, baxes);
+    if ((long)aaxes.size() != details::tensordot_naxes<Axes>::value ||
+        aaxes.size() != baxes.size())
+      throw types::ValueError("shape-mismatch for sum");
+
+    // axes of a are labelled 0 to N0 - 1, axes of b N0 to N0 + N1 - 1, but
+    // for those summed with an axis of a
+    std::vector<int> alabels(N0), blabels(N1), labels;
+    for (long i = 0; i < N0; ++i)
+      alabels[i] = i;
+    for (long j = 0; j < N1; ++j)
+      blabels[j] = N0 + j;
+    for (size_t i = 0; i < aaxes.size(); ++i) {
+      if (aaxes[i] < 0 || aaxes[i] >= N0 || baxes[i] < 0 || baxes[i] >= N1 ||
+          blabels[baxes[i]] < N0 ||
+          std::count(blabels.begin(), blabels.end(), aaxes[i]))
+        throw types::ValueError("tensordot: invalid axes");
+      blabels[baxes[i]] = aaxes[i];
+    }
+    for (int label : alabels)
+      if (!std::count(blabels.begin(), blabels.end(), label))
+        labels.push_back(label);
+    for (int label : blabels)
+      if (label >= N0)
+        labels.push_back(label);
+
+    auto const &aa = asarray(a);
+    auto const &bb = asarray(b);
+    std::vector<utils::tensor<T>> operands;
+    operands.push_back(details::einsum_operand<T>(aa, alabels));
+    operands.push_back(details::einsum_operand<T>(bb, blabels));
+
+    std::vector<long> extents(operands[0].shape);
+    extents.insert(extents.end(), operands[1].shape.begin(),
+                   operands[1].shape.end());
+    for (size_t i = 0; i < aaxes.size(); ++i)
+      if (extents[aaxes[i]] != extents[N0 + baxes[i]])
+        throw types::ValueError("shape-mismatch for sum");
+
+    return details::einsum_output<N0 + N1 - 2 * details::tensordot_naxes<
+                                                    Axes>::value>(
+        utils::contract_all(std::move(operands), labels, extents));
+  }
+}
+PYTHONIC_NS_END
+
+#endif
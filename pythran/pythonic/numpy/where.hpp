@@ -22,6 +22,19 @@ namespace numpy
       else
         return false_;
     }
+
+#ifdef USE_XSIMD
+    /* Vectorized form: both branches are evaluated and blended according to
+     * the mask, as numpy does, without branching per element.
+     */
+    template <class T, size_t N>
+    xsimd::batch<T, N> where(xsimd::batch_bool<T, N> const &cond,
+                             xsimd::batch<T, N> const &true_,
+                             xsimd::batch<T, N> const &false_)
+    {
+      return xsimd::select(cond, true_, false_);
+    }
+#endif
   }
 
 #define NUMPY_NARY_FUNC_NAME where
@@ -4,7 +4,7 @@
 #include "pythonic/include/operator_/matmul.hpp"
 
 #include "pythonic/utils/functor.hpp"
-#include "pythonic/numpy/dot.hpp"
+#include "pythonic/numpy/matmul.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -12,9 +12,10 @@ namespace operator_
 {
 
   template <class A, class B>
-  auto matmul(A const &a, B const &b) -> decltype(numpy::functor::dot{}(a, b))
+  auto matmul(A const &a, B const &b)
+      -> decltype(numpy::functor::matmul{}(a, b))
   {
-    return numpy::functor::dot{}(a, b);
+    return numpy::functor::matmul{}(a, b);
   }
 }
 PYTHONIC_NS_END
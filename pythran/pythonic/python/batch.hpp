@@ -0,0 +1,155 @@
+#ifndef PYTHONIC_PYTHON_BATCH_HPP
+#define PYTHONIC_PYTHON_BATCH_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/python/core.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/list.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace python
+{
+
+  /* Support for the ``<name>_batched'' entry points generated for functions
+   * exported with scalar-only signatures: the exported kernel is called in a
+   * native loop over sequences of arguments, so that the Python call overhead
+   * is paid once per batch instead of once per element.
+   */
+
+  /* A column of arguments, built from a one-dimensional array with the
+   * exact dtype, or from a list of scalars.
+   */
+  template <class T>
+  struct batch_column {
+    types::ndarray<T, types::pshape<long>> values;
+
+    batch_column() = default;
+    batch_column(types::ndarray<T, types::pshape<long>> const &values)
+        : values(values)
+    {
+    }
+
+    long size() const
+    {
+      return values.template shape<0>();
+    }
+
+    T operator[](long i) const
+    {
+      return values.buffer[i];
+    }
+  };
+
+  /* Scalar results are gathered in an array, other results in a list
+   */
+  template <class R, bool = types::is_dtype<R>::value>
+  struct batch_result {
+    using type = types::ndarray<R, types::pshape<long>>;
+    static type make(long n)
+    {
+      return type(types::pshape<long>(n), types::none_type{});
+    }
+    static void set(type &out, long i, R const &value)
+    {
+      out.buffer[i] = value;
+    }
+  };
+
+  template <class R>
+  struct batch_result<R, false> {
+    using type = types::list<R>;
+    static type make(long n)
+    {
+      type out(0);
+      out.reserve(n);
+      return out;
+    }
+    static void set(type &out, long, R const &value)
+    {
+      out.push_back(value);
+    }
+  };
+
+  long batch_size()
+  {
+    return 0;
+  }
+
+  template <class Col, class... Cols>
+  long batch_size(Col const &col, Cols const &... cols)
+  {
+    long n = col.size();
+    std::initializer_list<bool> _ = {(n == cols.size())...};
+    for (bool same : _)
+      if (!same)
+        throw types::ValueError("batched arguments have different lengths");
+    return n;
+  }
+
+  template <class F, class... Cols>
+  auto batch_call(F f, Cols const &... cols) -> typename batch_result<
+      typename std::decay<decltype(f(cols[0]...))>::type>::type
+  {
+    using helper =
+        batch_result<typename std::decay<decltype(f(cols[0]...))>::type>;
+    long n = batch_size(cols...);
+    auto out = helper::make(n);
+    for (long i = 0; i < n; ++i)
+      helper::set(out, i, f(cols[i]...));
+    return out;
+  }
+
+  template <class F, class Rows, size_t... Is>
+  auto _batch_call_rows(F f, Rows const &rows, utils::index_sequence<Is...>)
+      -> typename batch_result<typename std::decay<decltype(
+          f(std::get<Is>(rows[0])...))>::type>::type
+  {
+    using helper = batch_result<
+        typename std::decay<decltype(f(std::get<Is>(rows[0])...))>::type>;
+    long n = rows.size();
+    auto out = helper::make(n);
+    for (long i = 0; i < n; ++i) {
+      auto const &row = rows.fast(i);
+      helper::set(out, i, f(std::get<Is>(row)...));
+    }
+    return out;
+  }
+
+  template <class F, class Rows>
+  auto batch_call_rows(F f, Rows const &rows) -> decltype(_batch_call_rows(
+      f, rows, utils::make_index_sequence<std::tuple_size<
+                   typename std::decay<Rows>::type::value_type>::value>()))
+  {
+    return _batch_call_rows(
+        f, rows, utils::make_index_sequence<std::tuple_size<
+                     typename std::decay<Rows>::type::value_type>::value>());
+  }
+}
+
+template <class T>
+struct from_python<python::batch_column<T>> {
+  static bool is_convertible(PyObject *obj)
+  {
+    return ::is_convertible<types::ndarray<T, types::pshape<long>>>(obj) ||
+           ::is_convertible<types::list<T>>(obj);
+  }
+
+  static python::batch_column<T> convert(PyObject *obj)
+  {
+    if (PyArray_Check(obj))
+      return {::from_python<types::ndarray<T, types::pshape<long>>>(obj)};
+    else
+      return {types::ndarray<T, types::pshape<long>>(
+          ::from_python<types::list<T>>(obj))};
+  }
+};
+
+PYTHONIC_NS_END
+
+#endif
+
+#endif
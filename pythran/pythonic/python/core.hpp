@@ -10,6 +10,9 @@
 #include <type_traits>
 #include <utility>
 #include <sstream>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 
 // Cython still uses the deprecated API, so we can't set this macro in this
 // case!
@@ -46,6 +49,18 @@ bool is_convertible(PyObject *obj)
   return pythonic::from_python<T>::is_convertible(obj);
 }
 
+// Exported functions use the vectorcall protocol when available
+#if PY_VERSION_HEX >= 0x03070000
+#define PYTHRAN_FASTCALL_PARAMS                                                \
+  PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames
+#define PYTHRAN_FASTCALL_ARGS args, nargs, kwnames
+#define PYTHRAN_METH_FASTCALL METH_FASTCALL
+#else
+#define PYTHRAN_FASTCALL_PARAMS PyObject *args, PyObject *kwnames
+#define PYTHRAN_FASTCALL_ARGS args, kwnames
+#define PYTHRAN_METH_FASTCALL METH_VARARGS
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace python
@@ -166,6 +181,229 @@ namespace python
     PyErr_SetString(PyExc_TypeError, oss.str().c_str());
     return nullptr;
   }
+  /* Argument parsing for exported functions
+   *
+   * Positional and keyword arguments are stored in ``args_obj'', which has
+   * room for ``n'' arguments named after ``keywords'', a null-terminated
+   * list that is empty when the parameters are positional only. The number
+   * of arguments is returned, or -1 if they do not form a prefix of the
+   * parameter list (unknown or duplicate keyword, missing parameter).
+   */
+  long keyword_index(PyObject *key, char const *const keywords[], long n)
+  {
+    for (long i = 0; i < n && keywords[i]; ++i)
+      if (PyUnicode_CompareWithASCIIString(key, keywords[i]) == 0)
+        return i;
+    return -1;
+  }
+
+  long count_args(PyObject **args_obj, long filled)
+  {
+    for (long i = 0; i < filled; ++i)
+      if (!args_obj[i])
+        return -1;
+    return filled;
+  }
+
+  long parse_args(PyObject **args_obj, long n, char const *const keywords[],
+                  PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+  {
+    if (nargs > n)
+      return -1;
+    std::fill(args_obj, args_obj + n, nullptr);
+    std::copy(args, args + nargs, args_obj);
+    long filled = nargs;
+    if (kwnames) {
+      for (Py_ssize_t k = 0, nk = PyTuple_GET_SIZE(kwnames); k < nk; ++k) {
+        long slot = keyword_index(PyTuple_GET_ITEM(kwnames, k), keywords, n);
+        if (slot < 0 || args_obj[slot])
+          return -1;
+        args_obj[slot] = args[nargs + k];
+        ++filled;
+      }
+    }
+    return count_args(args_obj, filled);
+  }
+
+  long parse_args(PyObject **args_obj, long n, char const *const keywords[],
+                  PyObject *args, PyObject *kwargs)
+  {
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    if (nargs > n)
+      return -1;
+    std::fill(args_obj, args_obj + n, nullptr);
+    for (Py_ssize_t i = 0; i < nargs; ++i)
+      args_obj[i] = PyTuple_GET_ITEM(args, i);
+    long filled = nargs;
+    if (kwargs) {
+      PyObject *key, *value;
+      Py_ssize_t pos = 0;
+      while (PyDict_Next(kwargs, &pos, &key, &value)) {
+        long slot = keyword_index(key, keywords, n);
+        if (slot < 0 || args_obj[slot])
+          return -1;
+        args_obj[slot] = value;
+        ++filled;
+      }
+    }
+    return count_args(args_obj, filled);
+  }
+
+  std::nullptr_t raise_invalid_argument(char const name[],
+                                        char const alternatives[],
+                                        PyObject *const *args,
+                                        Py_ssize_t nargs, PyObject *kwnames)
+  {
+    PyObject *args_tuple = PyTuple_New(nargs);
+    PyObject *kwargs = kwnames ? PyDict_New() : nullptr;
+    if (!args_tuple || (kwnames && !kwargs)) {
+      Py_XDECREF(args_tuple);
+      return nullptr;
+    }
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+      Py_INCREF(args[i]);
+      PyTuple_SET_ITEM(args_tuple, i, args[i]);
+    }
+    if (kwnames)
+      for (Py_ssize_t k = 0, nk = PyTuple_GET_SIZE(kwnames); k < nk; ++k)
+        PyDict_SetItem(kwargs, PyTuple_GET_ITEM(kwnames, k), args[nargs + k]);
+    raise_invalid_argument(name, alternatives, args_tuple, kwargs);
+    Py_DECREF(args_tuple);
+    Py_XDECREF(kwargs);
+    return nullptr;
+  }
+
+  /* Overload resolution cache
+   *
+   * Each argument is summarized by a compact key that captures everything
+   * from_python<...>::is_convertible inspects: the exact type of scalars, and
+   * the dtype, rank and memory layout of arrays. Zero means that no such
+   * summary exists (e.g. for containers, whose convertibility depends on
+   * their content, or for arrays when some overload has fixed dimensions),
+   * in which case the overloads are checked one after the other.
+   */
+  template <bool with_shape>
+  uintptr_t type_key(PyObject *obj)
+  {
+    if (PyArray_Check(obj)) {
+      if (with_shape)
+        return 0;
+      PyArrayObject *arr = reinterpret_cast<PyArrayObject *>(obj);
+      long const ndim = PyArray_NDIM(arr);
+      auto const *stride = PyArray_STRIDES(arr);
+      auto const *dims = PyArray_DIMS(arr);
+
+      // ndarray layout, see from_python<ndarray>::is_convertible
+      bool c_packed = true;
+      long current_stride = PyArray_ITEMSIZE(arr);
+      for (long i = ndim - 1; i >= 0; i--) {
+        if (stride[i] == 0 && dims[i] == 1) {
+        } else if (stride[i] != current_stride) {
+          c_packed = false;
+          break;
+        }
+        current_stride *= dims[i];
+      }
+      // texpr layout, see from_python<numpy_texpr>::is_convertible
+      bool f_packed = true;
+      current_stride = PyArray_ITEMSIZE(arr);
+      for (long i = 0; i < ndim; i++) {
+        if (stride[i] != current_stride) {
+          f_packed = false;
+          break;
+        }
+        current_stride *= dims[i];
+      }
+      // gexpr layout, see from_python<numpy_gexpr>::is_convertible
+      bool g_negative = false;
+      current_stride = PyArray_ITEMSIZE(arr);
+      for (long i = ndim - 1; i >= 0; i--) {
+        if (stride[i] < 0) {
+          g_negative = true;
+          break;
+        }
+        if (stride[i] == 0 && dims[i] == 1) {
+        } else if (stride[i] != current_stride)
+          break;
+        current_stride *= dims[i];
+      }
+      PyObject *base_obj = PyArray_BASE(arr);
+      long base_ndim =
+          (base_obj && PyArray_Check(base_obj))
+              ? PyArray_NDIM(reinterpret_cast<PyArrayObject *>(base_obj)) + 1
+              : 0;
+      long flags = PyArray_FLAGS(arr);
+      uintptr_t layout =
+          c_packed | f_packed << 1 | g_negative << 2 |
+          ((flags & NPY_ARRAY_C_CONTIGUOUS) != 0) << 3 |
+          ((flags & NPY_ARRAY_F_CONTIGUOUS) != 0) << 4;
+      return ((uintptr_t)PyArray_TYPE(arr) << 24 | (uintptr_t)ndim << 16 |
+              layout << 8 | (uintptr_t)(base_ndim & 0xFF))
+                 << 1 |
+             1;
+    }
+    if (PyLong_CheckExact(obj) || PyFloat_CheckExact(obj) ||
+        PyComplex_CheckExact(obj) || PyBool_Check(obj) || obj == Py_None ||
+        PyUnicode_CheckExact(obj) || PyArray_IsScalar(obj, Generic))
+      // type objects are aligned, so this never collides with array keys
+      return (uintptr_t)Py_TYPE(obj);
+    return 0;
+  }
+
+  template <size_t N>
+  using dispatch_key = std::array<uintptr_t, N + 1>;
+
+  template <bool with_shape, size_t N>
+  bool make_dispatch_key(dispatch_key<N> &key, PyObject *const *args_obj,
+                         long n)
+  {
+    key[0] = n;
+    for (long i = 0; i < n; ++i)
+      if (!(key[i + 1] = type_key<with_shape>(args_obj[i])))
+        return false;
+    std::fill(key.begin() + n + 1, key.end(), 0);
+    return true;
+  }
+
+  /* Direct-mapped table from argument keys to the index of the overload they
+   * resolved to. It is only accessed while holding the GIL.
+   */
+  template <size_t N>
+  struct dispatch_table {
+    static constexpr size_t size = 64;
+    struct entry {
+      dispatch_key<N> key;
+      long index;
+    };
+    std::array<entry, size> entries;
+
+    dispatch_table()
+    {
+      for (auto &e : entries)
+        e.index = -1;
+    }
+
+    static size_t slot(dispatch_key<N> const &key)
+    {
+      uint64_t h = 0;
+      for (auto k : key)
+        h = (h ^ k) * 0x9E3779B97F4A7C15ULL;
+      return (h >> 32) % size;
+    }
+
+    long lookup(dispatch_key<N> const &key) const
+    {
+      entry const &e = entries[slot(key)];
+      return e.key == key ? e.index : -1;
+    }
+
+    void insert(dispatch_key<N> const &key, long index)
+    {
+      entry &e = entries[slot(key)];
+      e.key = key;
+      e.index = index;
+    }
+  };
 }
 
 PYTHONIC_NS_END
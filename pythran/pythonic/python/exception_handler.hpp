@@ -13,6 +13,17 @@ PYTHONIC_NS_BEGIN
 template <class F>
 PyObject *handle_python_exception(F &&f)
 {
+#ifdef PYTHONIC_BUILTIN_PRINT_HPP
+  // buffered output must reach stdout before Python writes to it again
+  struct flush_stdout {
+    ~flush_stdout()
+    {
+      auto &buffer = pythonic::utils::stdout_buffer();
+      std::lock_guard<std::mutex> guard(buffer.mutex());
+      buffer.flush();
+    }
+  } flush_on_return;
+#endif
   try {
     return f();
   }
@@ -16,9 +16,88 @@ PYTHONIC_NS_BEGIN
 namespace types
 {
 
+  namespace details
+  {
+    template <class T>
+    str format_exception_arg(T const &value)
+    {
+      return builtins::functor::str{}(value);
+    }
+
+    inline str const &format_exception_arg(str const &value)
+    {
+      return value;
+    }
+  }
+
+  template <class... Types>
+  template <class... Args>
+  exception_args::holder<Types...>::holder(Args const &... args)
+      : captured(details::exception_arg<Args>::capture(args)...)
+  {
+  }
+
+  template <class... Types>
+  dynamic_tuple<str> exception_args::holder<Types...>::format() const
+  {
+    return format(utils::make_index_sequence<sizeof...(Types)>());
+  }
+
+  template <class... Types>
+  template <size_t... Is>
+  dynamic_tuple<str> exception_args::holder<Types...>::format(
+      utils::index_sequence<Is...>) const
+  {
+    return {details::format_exception_arg(std::get<Is>(captured))...};
+  }
+
+  template <class... Types>
+  exception_args::exception_args(Types const &... types)
+      : holder_(std::make_shared<
+                holder<typename details::exception_arg<Types>::type...>>(
+            types...))
+  {
+  }
+
+  dynamic_tuple<str> const &exception_args::get() const
+  {
+    static dynamic_tuple<str> const empty;
+    if (!holder_)
+      return empty;
+    if (!holder_->formatted) {
+      holder_->values = holder_->format();
+      holder_->formatted = true;
+    }
+    return holder_->values;
+  }
+
+  long exception_args::size() const
+  {
+    return get().size();
+  }
+
+  str const &exception_args::operator[](long i) const
+  {
+    return get()[i];
+  }
+
+  dynamic_tuple<str>::const_iterator exception_args::begin() const
+  {
+    return get().begin();
+  }
+
+  dynamic_tuple<str>::const_iterator exception_args::end() const
+  {
+    return get().end();
+  }
+
+  std::ostream &operator<<(std::ostream &o, exception_args const &args)
+  {
+    return o << args.get();
+  }
+
   template <typename... Types>
-  BaseException::BaseException(Types const &... types)
-      : args({builtins::functor::str{}(types)...})
+  BaseException::BaseException(Types const &... types) : args(types...)
   {
   }
 
@@ -91,7 +170,7 @@ PYTHONIC_NS_END
     types::none<types::dynamic_tuple<types::str>>                              \
     getattr(types::attr::ARGS, types::name const &f)                           \
     {                                                                          \
-      return f.args;                                                           \
+      return f.args.get();                                                     \
     }                                                                          \
   }                                                                            \
   PYTHONIC_NS_END
@@ -104,7 +183,7 @@ PYTHONIC_NS_END
     getattr(types::attr::ARGS, types::name const &e)                           \
     {                                                                          \
       if (e.args.size() > 3 || e.args.size() < 2)                              \
-        return e.args;                                                         \
+        return e.args.get();                                                   \
       else                                                                     \
         return types::dynamic_tuple<types::str>(e.args.begin(),                \
                                                 e.args.begin() + 2);           \
@@ -29,13 +29,13 @@ namespace types
 
   /// _file implementation
 
-  _file::_file() : f(nullptr)
+  _file::_file() : f(nullptr), start(0), end(0)
   {
   }
 
   // TODO : no check on file existance?
   _file::_file(types::str const &filename, types::str const &strmode)
-      : f(fopen(filename.c_str(), strmode.c_str()))
+      : f(fopen(filename.c_str(), strmode.c_str())), start(0), end(0)
   {
   }
 
@@ -97,6 +97,8 @@ namespace types
   {
     fclose(**data);
     data->f = nullptr;
+    data->buffer.reset();
+    data->start = data->end = 0;
     is_open = false;
   }
 
@@ -121,15 +123,37 @@ namespace types
     return newlines;
   }
 
+  bool file::fill()
+  {
+    if (!data->buffer)
+      data->buffer.reset(new char[PYTHRAN_FILE_BUFFER_SIZE]);
+    data->start = 0;
+    data->end = fread(data->buffer.get(), sizeof(char),
+                      PYTHRAN_FILE_BUFFER_SIZE, **data);
+    return data->end != 0;
+  }
+
+  void file::unread()
+  {
+    // streams that cannot seek, such as pipes, keep the block for the next
+    // reads, as nothing can be handed back to them
+    if (data->start != data->end &&
+        fseek(**data, data->start - data->end, SEEK_CUR) != 0)
+      return;
+    data->start = data->end = 0;
+  }
+
   bool file::eof()
   {
-    return ::feof(**data);
+    return data->start == data->end && ::feof(**data);
   }
 
   void file::flush()
   {
     if (!is_open)
       throw ValueError("I/O operation on closed file");
+    if (data->buffer)
+      unread();
     fflush(**data);
   }
 
@@ -153,18 +177,26 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("r+") == -1)
       throw IOError("File not open for reading");
-    if (size == 0 || (feof(**data) && mode.find_first_of("ra") == -1))
+    if (size == 0 || (eof() && mode.find_first_of("ra") == -1))
       return types::str();
-    long curr_pos = tell();
-    seek(0, SEEK_END);
-    size = size < 0 ? tell() - curr_pos : size;
-    seek(curr_pos);
-    std::unique_ptr<char[]> content{new char[size + 1]};
-    // This part needs a new implementation of types::str(char*) to avoid
-    // unnecessary copy.
-    types::str res(content.get(),
-                   fread(content.get(), sizeof(char), size, **data));
-    return res;
+    long buffered = data->end - data->start;
+    if (size < 0) {
+      long curr_pos = ftell(**data);
+      fseek(**data, 0, SEEK_END);
+      size = buffered + ftell(**data) - curr_pos;
+      fseek(**data, curr_pos, SEEK_SET);
+    }
+    // read straight into the storage of the result, after what is left of
+    // the current block
+    std::string content(size, '\0');
+    long n = std::min(buffered, size);
+    if (n) {
+      std::memcpy(&content[0], data->buffer.get() + data->start, n);
+      data->start += n;
+    }
+    n += fread(&content[n], sizeof(char), size - n, **data);
+    content.resize(n);
+    return types::str(std::move(content));
   }
 
   types::str file::readline(long size)
@@ -173,28 +205,34 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("r+") == -1)
       throw IOError("File not open for reading");
-    constexpr static long BUFFER_SIZE = 1024;
-    types::str res;
-    char read_str[BUFFER_SIZE];
-
-    for (long i = 0; i < size; i += BUFFER_SIZE) {
-      // +1 because we read the last chunk so we don't want to count \0
-      if (fgets(read_str, std::min(BUFFER_SIZE - 1, size - i) + 1, **data))
-        res += read_str;
-      if (feof(**data) || res[res.size() - 1] == "\n")
+    // lines that fit in the current block are copied once from it, the
+    // others are gathered block by block
+    std::string res;
+    while (size > 0) {
+      if (data->start == data->end && !fill())
+        break;
+      char const *first = data->buffer.get() + data->start;
+      long avail = std::min(data->end - data->start, size);
+      char const *eol = (char const *)memchr(first, '\n', avail);
+      long n = eol ? eol - first + 1 : avail;
+      data->start += n;
+      if (eol && res.empty())
+        return types::str(first, n);
+      res.append(first, n);
+      if (eol)
         break;
+      size -= n;
     }
-    return res;
+    return types::str(std::move(res));
   }
 
   types::list<types::str> file::readlines(long sizehint)
   {
     // Official python doc specifies that sizehint is used as a max of chars
     // But it has not been implemented in the standard python interpreter...
-    types::str str;
     types::list<types::str> lst(0);
-    while ((str = readline()))
-      lst.push_back(str);
+    while (types::str line = readline())
+      lst.push_back(std::move(line));
     return lst;
   }
 
@@ -204,6 +242,9 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (whence != SEEK_SET && whence != SEEK_CUR && whence != SEEK_END)
       throw IOError("file.seek() :  Invalid argument.");
+    if (whence == SEEK_CUR)
+      offset -= data->end - data->start;
+    data->start = data->end = 0;
     fseek(**data, offset, whence);
   }
 
@@ -211,7 +252,7 @@ namespace types
   {
     if (!is_open)
       throw ValueError("I/O operation on closed file");
-    return ftell(**data);
+    return ftell(**data) - (data->end - data->start);
   }
 
   void file::truncate(long size)
@@ -228,12 +269,19 @@ namespace types
   }
 
   long file::write(types::str const &str)
+  {
+    return write(str.c_str(), str.size());
+  }
+
+  long file::write(char const *s, long n)
   {
     if (!is_open)
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("wa+") == -1)
       throw IOError("file.write() :  File not open for writing.");
-    return fwrite(str.c_str(), sizeof(char), str.size(), **data);
+    if (data->buffer)
+      unread();
+    return fwrite(s, sizeof(char), n, **data);
   }
 
   template <class T>
@@ -250,7 +298,7 @@ namespace types
   // for line in open("myfile"):
   //     print line
   file_iterator::file_iterator(file &ref)
-      : f(&ref), set(false), curr(), position(ref.tell())
+      : f(&ref), set(false), curr(), position(0)
   {
   }
 
@@ -258,41 +306,50 @@ namespace types
       : f(nullptr), set(false), curr(),
         position(std::numeric_limits<long>::max()){};
 
+  // the end of the file is only known once the next line is read
+  long file_iterator::peek() const
+  {
+    if (!set && position != std::numeric_limits<long>::max()) {
+      curr = f->readline();
+      set = true;
+      if (!curr)
+        position = std::numeric_limits<long>::max();
+    }
+    return position;
+  }
+
   bool file_iterator::operator==(file_iterator const &f2) const
   {
-    return position == f2.position;
+    return peek() == f2.peek();
   }
 
   bool file_iterator::operator!=(file_iterator const &f2) const
   {
-    return position != f2.position;
+    return peek() != f2.peek();
   }
 
   bool file_iterator::operator<(file_iterator const &f2) const
   {
     // Not really elegant...
     // Equivalent to 'return *this != f2;'
-    return position < f2.position;
+    return peek() < f2.peek();
   }
 
   file_iterator &file_iterator::operator++()
   {
-    if (f->eof())
-      return *this;
-    operator*();
-    set = false;
-    operator*();
-    position = f->eof() ? std::numeric_limits<long>::max() : f->tell();
+    // the current line is shared with the caller, not copied, as it is
+    // replaced rather than updated by the next one
+    if (peek() != std::numeric_limits<long>::max()) {
+      set = false;
+      ++position;
+    }
     return *this;
   }
 
   types::str file_iterator::operator*() const
   {
-    if (!set) {
-      curr = f->readline();
-      set = true;
-    }
-    return curr.chars(); // to make a copy
+    peek();
+    return curr;
   }
 }
 PYTHONIC_NS_END
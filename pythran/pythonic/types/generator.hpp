@@ -26,6 +26,8 @@ namespace types
   template <class T>
   generator_iterator<T> &generator_iterator<T>::operator++()
   {
+    // generators end through their state, an exception only gets there
+    // when explicitly raised
     try {
       the_generator.next();
     } catch (types::StopIteration const &) {
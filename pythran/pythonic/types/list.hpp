@@ -223,7 +223,7 @@ namespace types
   template <class V>
   bool sliced_list<T, S>::contains(V const &v) const
   {
-    return std::find(data->begin(), data->end(), v) != data->end();
+    return std::find(begin(), end(), v) != end();
   }
   template <class T, class S>
   intptr_t sliced_list<T, S>::id() const
@@ -41,8 +41,10 @@
 #include "pythonic/types/numpy_iexpr.hpp"
 #include "pythonic/types/numpy_gexpr.hpp"
 #include "pythonic/types/numpy_vexpr.hpp"
+#include "pythonic/types/numpy_cexpr.hpp"
 #include "pythonic/utils/numpy_traits.hpp"
 #include "pythonic/utils/array_helper.hpp"
+#include "pythonic/utils/nonzero.hpp"
 
 #include "pythonic/builtins/len.hpp"
 #include "pythonic/operator_/iadd.hpp"
@@ -145,7 +147,7 @@ namespace types
     sutils::assign(
         std::get<std::tuple_size<S>::value - std::tuple_size<pS>::value>(shape),
         iter.size());
-    for (auto content : iter)
+    for (auto &&content : iter)
       from = type_helper<ndarray<T, sutils::pop_tail_t<pS>> const &>::
           initialize_from_iterable(shape, from, content);
     return from;
@@ -388,6 +390,24 @@ namespace types
     std::copy(other.fbegin(), other.fend(), fbegin());
   }
 
+  template <class T, class pS>
+  template <class pSp>
+  ndarray<T, pS>::ndarray(ndarray<T, pSp> &&other)
+      : mem(utils::no_memory()), buffer(nullptr), _shape(other._shape),
+        _strides(other._strides)
+  {
+    static_assert(std::tuple_size<pS>::value == std::tuple_size<pSp>::value,
+                  "compatible shapes");
+    if (other.is_unique()) {
+      mem = std::move(other.mem);
+      buffer = mem->data;
+    } else {
+      mem = utils::shared_ref<raw_array<T>>(other.flat_size());
+      buffer = mem->data;
+      std::copy(other.fbegin(), other.fend(), fbegin());
+    }
+  }
+
   /* from a seed */
   template <class T, class pS>
   ndarray<T, pS>::ndarray(pS const &shape, none_type init)
@@ -764,13 +784,8 @@ namespace types
       numpy_vexpr<ndarray<T, pS>, ndarray<long, pshape<long>>>>::type
   ndarray<T, pS>::fast(F const &filter) const
   {
-    long sz = filter.template shape<0>();
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
+    long n;
+    long *raw = utils::nonzero_indices(filter, n);
     return this->fast(ndarray<long, pshape<long>>(raw, pshape<long>(n),
                                                   types::ownership::owned));
   }
@@ -939,6 +954,12 @@ namespace types
     return {mem, pshape<long>{{flat_size()}}};
   }
 
+  template <class T, class pS>
+  bool ndarray<T, pS>::is_unique() const
+  {
+    return mem.unique() && !mem->is_external() && buffer == mem->data;
+  }
+
   template <class T, class pS>
   ndarray<T, pS> ndarray<T, pS>::copy() const
   {
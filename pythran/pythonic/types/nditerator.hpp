@@ -217,6 +217,14 @@ namespace types
     val.store_unaligned(const_cast<typename E::dtype *>(data));
   }
 
+  template <class E>
+  template <class Op>
+  void const_simd_nditerator<E>::update(
+      xsimd::simd_type<typename E::dtype> const &val)
+  {
+    store(Op{}(**this, val));
+  }
+
   template <class E>
   const_simd_nditerator<E> &const_simd_nditerator<E>::operator++()
   {
@@ -279,6 +287,93 @@ namespace types
     data = other.data;
     return *this;
   }
+
+  template <class E>
+  const_simd_indexed_nditerator<E>::const_simd_indexed_nditerator(
+      E const &data, long index)
+      : data(&data), index(index)
+  {
+  }
+
+  template <class E>
+  typename const_simd_indexed_nditerator<E>::vector_type
+      const_simd_indexed_nditerator<E>::
+      operator*() const
+  {
+    return data->vload(index);
+  }
+
+  template <class E>
+  void const_simd_indexed_nditerator<E>::store(vector_type const &val)
+  {
+    const_cast<E *>(data)->vstore(index, val);
+  }
+
+  template <class E>
+  template <class Op>
+  void const_simd_indexed_nditerator<E>::update(vector_type const &val)
+  {
+    const_cast<E *>(data)->template vupdate<Op>(index, val);
+  }
+
+  template <class E>
+  const_simd_indexed_nditerator<E> &const_simd_indexed_nditerator<E>::
+  operator++()
+  {
+    index += vector_size;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_indexed_nditerator<E> &const_simd_indexed_nditerator<E>::
+  operator+=(long i)
+  {
+    index += vector_size * i;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_indexed_nditerator<E> const_simd_indexed_nditerator<E>::
+  operator+(long i) const
+  {
+    return {*data, index + long(vector_size) * i};
+  }
+
+  template <class E>
+  const_simd_indexed_nditerator<E> &const_simd_indexed_nditerator<E>::
+  operator--()
+  {
+    index -= vector_size;
+    return *this;
+  }
+
+  template <class E>
+  long const_simd_indexed_nditerator<E>::
+  operator-(const_simd_indexed_nditerator<E> const &other) const
+  {
+    return (index - other.index) / long(vector_size);
+  }
+
+  template <class E>
+  bool const_simd_indexed_nditerator<E>::
+  operator!=(const_simd_indexed_nditerator<E> const &other) const
+  {
+    return index != other.index;
+  }
+
+  template <class E>
+  bool const_simd_indexed_nditerator<E>::
+  operator==(const_simd_indexed_nditerator<E> const &other) const
+  {
+    return index == other.index;
+  }
+
+  template <class E>
+  bool const_simd_indexed_nditerator<E>::
+  operator<(const_simd_indexed_nditerator<E> const &other) const
+  {
+    return index < other.index;
+  }
 #endif
 
   // build an iterator over T, selecting a raw pointer if possible
@@ -0,0 +1,187 @@
+#ifndef PYTHONIC_TYPES_NUMPY_CEXPR_HPP
+#define PYTHONIC_TYPES_NUMPY_CEXPR_HPP
+
+#include "pythonic/include/types/numpy_cexpr.hpp"
+
+#include "pythonic/types/nditerator.hpp"
+#include "pythonic/utils/shared_ref.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+
+  template <class E>
+  numpy_cexpr<E>::cache::cache() : start(0), stop(0), values(block)
+  {
+  }
+
+  template <class E>
+  numpy_cexpr<E>::numpy_cexpr()
+      : expr_(), cache_(utils::no_memory()), size_(0), vectorize_(false)
+  {
+  }
+
+  template <class E>
+  template <class F, class>
+  numpy_cexpr<E>::numpy_cexpr(F const &expr)
+      : expr_(expr), cache_(), size_(expr_.template shape<0>()),
+        vectorize_(utils::no_broadcast_vectorize(expr_))
+  {
+    if (!utils::no_broadcast_ex(expr_))
+      whole();
+  }
+
+  template <class E>
+  numpy_cexpr<E> &numpy_cexpr<E>::operator=(numpy_cexpr const &other)
+  {
+    // expressions can be built but not assigned: build a copy in place
+    if (this != &other) {
+      expr_.~E();
+      new (&expr_) E(other.expr_);
+      cache_ = other.cache_;
+      size_ = other.size_;
+      vectorize_ = other.vectorize_;
+    }
+    return *this;
+  }
+
+  template <class E>
+  long numpy_cexpr<E>::flat_size() const
+  {
+    return size_;
+  }
+
+  template <class E>
+  long numpy_cexpr<E>::size() const
+  {
+    return size_;
+  }
+
+  template <class E>
+  typename numpy_cexpr<E>::const_iterator numpy_cexpr<E>::begin() const
+  {
+    return {*this, 0};
+  }
+
+  template <class E>
+  typename numpy_cexpr<E>::const_iterator numpy_cexpr<E>::end() const
+  {
+    return {*this, size_};
+  }
+
+  template <class E>
+  void numpy_cexpr<E>::fill(long start) const
+  {
+    cache &c = *cache_;
+    long n = std::min<long>(PYTHRAN_CACHE_BLOCK_SIZE, size_ - start);
+    long k = 0;
+#ifdef USE_XSIMD
+    if (vectorize_)
+      k = vfill(start, n, std::integral_constant<bool, E::is_vectorizable &&
+                                                           is_vectorizable>());
+#endif
+    for (; k < n; ++k)
+      c.block[k] = expr_.fast(start + k);
+    c.start = start;
+    c.stop = start + n;
+    c.values = c.block;
+  }
+
+  template <class E>
+  typename numpy_cexpr<E>::dtype const *numpy_cexpr<E>::fetch(long i) const
+  {
+    cache &c = *cache_;
+    // going back to an earlier block, as when the expression is broadcast
+    // along another dimension, would evaluate it again for each row
+    if (i < c.start)
+      whole();
+    else if (i >= c.stop)
+      fill(i - i % PYTHRAN_CACHE_BLOCK_SIZE);
+    return c.values + (i - c.start);
+  }
+
+  template <class E>
+  ndarray<typename numpy_cexpr<E>::dtype, pshape<long>> const &
+  numpy_cexpr<E>::whole() const
+  {
+    cache &c = *cache_;
+    if (!c.whole.buffer) {
+      c.whole = ndarray<dtype, pshape<long>>(expr_);
+      // all the following reads are served from it
+      c.start = 0;
+      c.stop = size_;
+      c.values = c.whole.buffer;
+    }
+    return c.whole;
+  }
+
+  template <class E>
+  typename numpy_cexpr<E>::dtype numpy_cexpr<E>::operator[](long i) const
+  {
+    if (i < 0)
+      i += size_;
+    assert(0 <= i && i < size_);
+    return fast(i);
+  }
+
+#ifdef USE_XSIMD
+  template <class E>
+  long numpy_cexpr<E>::vfill(long, long, std::false_type) const
+  {
+    return 0;
+  }
+
+  template <class E>
+  long numpy_cexpr<E>::vfill(long start, long n, std::true_type) const
+  {
+    using vector_type = xsimd::simd_type<dtype>;
+    static constexpr long vector_size = vector_type::size;
+    static_assert(PYTHRAN_CACHE_BLOCK_SIZE % vector_size == 0,
+                  "blocks hold whole vectors");
+    auto iter = expr_.vbegin(vectorize_nobroadcast{}) + start / vector_size;
+    long k = 0;
+    for (; k + vector_size <= n; k += vector_size, ++iter) {
+      vector_type values = *iter;
+      values.store_unaligned(cache_->block + k);
+    }
+    return k;
+  }
+
+  template <class E>
+  template <class vectorizer>
+  typename numpy_cexpr<E>::simd_iterator
+      numpy_cexpr<E>::vbegin(vectorizer) const
+  {
+    return {*this, 0};
+  }
+
+  template <class E>
+  template <class vectorizer>
+  typename numpy_cexpr<E>::simd_iterator
+      numpy_cexpr<E>::vend(vectorizer) const
+  {
+    using vector_type = typename xsimd::simd_type<dtype>;
+    static const std::size_t vector_size = vector_type::size;
+    return {*this, long(size_ / vector_size * vector_size)};
+  }
+
+  template <class E>
+  xsimd::simd_type<typename numpy_cexpr<E>::dtype>
+  numpy_cexpr<E>::vload(long i) const
+  {
+    // blocks start on a vector boundary, so a vector never spans two blocks
+    cache const &c = *cache_;
+    if (c.start <= i && i < c.stop)
+      return xsimd::load_unaligned(c.values + (i - c.start));
+    return xsimd::load_unaligned(fetch(i));
+  }
+#endif
+}
+PYTHONIC_NS_END
+
+#endif
@@ -4,6 +4,7 @@
 #include "pythonic/include/types/numpy_expr.hpp"
 
 #include "pythonic/utils/meta.hpp"
+#include "pythonic/utils/nonzero.hpp"
 #include "pythonic/types/nditerator.hpp"
 
 #include "pythonic/builtins/ValueError.hpp"
@@ -40,6 +41,13 @@ namespace types
   {
   }
 
+  template <class Op, class... Args>
+  template <class... Argp, class>
+  numpy_expr<Op, Args...>::numpy_expr(numpy_expr<Op, Argp...> const &other)
+      : args(other.args)
+  {
+  }
+
   template <class Op, class... Args>
   template <size_t... I>
   typename numpy_expr<Op, Args...>::const_iterator
@@ -310,13 +318,8 @@ namespace types
       numpy_vexpr<numpy_expr<Op, Args...>, ndarray<long, pshape<long>>>>::type
   numpy_expr<Op, Args...>::fast(F const &filter) const
   {
-    long sz = filter.template shape<0>();
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
+    long n;
+    long *raw = utils::nonzero_indices(filter, n);
     long shp[1] = {n};
     return this->fast(
         ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
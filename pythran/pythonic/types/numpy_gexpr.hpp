@@ -6,6 +6,7 @@
 #include "pythonic/builtins/ValueError.hpp"
 
 #include "pythonic/utils/meta.hpp"
+#include "pythonic/utils/nonzero.hpp"
 #include "pythonic/operator_/iadd.hpp"
 #include "pythonic/operator_/isub.hpp"
 #include "pythonic/operator_/imul.hpp"
@@ -713,13 +714,8 @@ namespace types
       numpy_vexpr<numpy_gexpr<Arg, S...>, ndarray<long, pshape<long>>>>::type
   numpy_gexpr<Arg, S...>::fast(F const &filter) const
   {
-    long sz = filter.template shape<0>();
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
+    long n;
+    long *raw = utils::nonzero_indices(filter, n);
     long shp[1] = {n};
     return this->fast(
         ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
@@ -7,6 +7,7 @@
 #include "pythonic/types/tuple.hpp"
 #include "pythonic/utils/array_helper.hpp"
 #include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/utils/nonzero.hpp"
 #include "pythonic/include/types/raw_array.hpp"
 #include "pythonic/types/ndarray.hpp" // we should remove that dep during a refactoring :-)
 
@@ -295,13 +296,8 @@ namespace types
       numpy_vexpr<numpy_iexpr<Arg>, ndarray<long, pshape<long>>>>::type
   numpy_iexpr<Arg>::fast(F const &filter) const
   {
-    long sz = filter.template shape<0>();
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
+    long n;
+    long *raw = utils::nonzero_indices(filter, n);
     long shp[1] = {n};
     return this->fast(
         ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
@@ -13,9 +13,17 @@ namespace types
       operator=(E const &expr)
   {
     // TODO: avoid the tmp copy when no aliasing
-    typename assignable<E>::type tmp{expr};
-    for (long i = 0, n = tmp.template shape<0>(); i < n; ++i)
-      (*this).fast(i) = tmp.fast(i);
+    using tmp_type = typename assignable<E>::type;
+    tmp_type tmp{expr};
+    if (value == 1)
+      utils::broadcast_copy<
+          numpy_vexpr &, tmp_type, value, 0,
+          is_vectorizable && types::is_vectorizable<tmp_type>::value &&
+              std::is_same<dtype, typename tmp_type::dtype>::value>(*this,
+                                                                     tmp);
+    else
+      for (long i = 0, n = tmp.template shape<0>(); i < n; ++i)
+        (*this).fast(i) = tmp.fast(i);
     return *this;
   }
   template <class T, class F>
@@ -81,7 +89,125 @@ namespace types
   {
     using vector_type = typename xsimd::simd_type<dtype>;
     static const std::size_t vector_size = vector_type::size;
-    return {*this, 0};
+    return {*this, long(shape<0>() / vector_size * vector_size)};
+  }
+
+  namespace details
+  {
+    // emulated gather, fully unrolled as the vector size is a constant
+    template <class T, class F>
+    xsimd::simd_type<typename T::dtype> vgather(T const &data, F const &view,
+                                                long i)
+    {
+      using vT = xsimd::simd_type<typename T::dtype>;
+      alignas(sizeof(vT)) typename T::dtype values[vT::size];
+      for (size_t k = 0; k < vT::size; ++k)
+        values[k] = data.load(view.fast(i + k));
+      return xsimd::load_aligned(values);
+    }
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+    // hardware gather from contiguous data through 64 bits indices
+    template <class T, class pS, class I>
+    using enable_hw_gather = typename std::enable_if<
+        ndarray<T, pS>::value == 1 && std::tuple_size<I>::value == 1 &&
+            sizeof(long) == 8,
+        xsimd::simd_type<T>>::type;
+
+#if defined(__AVX512F__)
+    template <class pS, class I>
+    enable_hw_gather<double, pS, I> vgather(ndarray<double, pS> const &data,
+                                            ndarray<long, I> const &view,
+                                            long i)
+    {
+      return _mm512_i64gather_pd(_mm512_loadu_si512(view.buffer + i),
+                                 data.buffer, 8);
+    }
+
+    template <class pS, class I>
+    enable_hw_gather<long, pS, I> vgather(ndarray<long, pS> const &data,
+                                          ndarray<long, I> const &view, long i)
+    {
+      return _mm512_i64gather_epi64(_mm512_loadu_si512(view.buffer + i),
+                                    data.buffer, 8);
+    }
+#else
+    template <class pS, class I>
+    enable_hw_gather<double, pS, I> vgather(ndarray<double, pS> const &data,
+                                            ndarray<long, I> const &view,
+                                            long i)
+    {
+      return _mm256_i64gather_pd(
+          data.buffer, _mm256_loadu_si256((__m256i const *)(view.buffer + i)),
+          8);
+    }
+
+    template <class pS, class I>
+    enable_hw_gather<long, pS, I> vgather(ndarray<long, pS> const &data,
+                                          ndarray<long, I> const &view, long i)
+    {
+      return _mm256_i64gather_epi64(
+          (long long const *)data.buffer,
+          _mm256_loadu_si256((__m256i const *)(view.buffer + i)), 8);
+    }
+
+    template <class pS, class I>
+    enable_hw_gather<float, pS, I> vgather(ndarray<float, pS> const &data,
+                                           ndarray<long, I> const &view, long i)
+    {
+      __m128 lo = _mm256_i64gather_ps(
+          data.buffer, _mm256_loadu_si256((__m256i const *)(view.buffer + i)),
+          4);
+      __m128 hi = _mm256_i64gather_ps(
+          data.buffer,
+          _mm256_loadu_si256((__m256i const *)(view.buffer + i + 4)), 4);
+      return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+#endif
+#endif
+  }
+
+  template <class T, class F>
+  xsimd::simd_type<typename numpy_vexpr<T, F>::dtype>
+  numpy_vexpr<T, F>::vload(long i) const
+  {
+    return details::vgather(data_, view_, i);
+  }
+
+  // scattered lanes are written in order, so the last duplicate wins
+  template <class T, class F>
+  void numpy_vexpr<T, F>::vstore(long i, xsimd::simd_type<dtype> const &value)
+  {
+    using vT = xsimd::simd_type<dtype>;
+    alignas(sizeof(vT)) dtype values[vT::size];
+    value.store_aligned(values);
+    for (size_t k = 0; k < vT::size; ++k)
+      data_.store(values[k], view_.fast(i + k));
+  }
+
+  // a gather / scatter update is only valid if the lanes are independent,
+  // otherwise duplicate indices are updated one after the other
+  template <class T, class F>
+  template <class Op>
+  void numpy_vexpr<T, F>::vupdate(long i, xsimd::simd_type<dtype> const &value)
+  {
+    using vT = xsimd::simd_type<dtype>;
+    long indices[vT::size];
+    for (size_t k = 0; k < vT::size; ++k)
+      indices[k] = view_.fast(i + k);
+    bool independent = true;
+    for (size_t k = 1; k < vT::size; ++k)
+      for (size_t l = 0; l < k; ++l)
+        independent &= indices[k] != indices[l];
+
+    if (independent) {
+      vstore(i, Op{}(vload(i), value));
+    } else {
+      alignas(sizeof(vT)) dtype values[vT::size];
+      value.store_aligned(values);
+      for (size_t k = 0; k < vT::size; ++k)
+        data_.template update<Op>(values[k], indices[k]);
+    }
   }
 #endif
 
@@ -95,13 +221,8 @@ namespace types
       numpy_vexpr<numpy_vexpr<T, F>, ndarray<long, pshape<long>>>>::type
   numpy_vexpr<T, F>::fast(E const &filter) const
   {
-    long sz = filter.template shape<0>();
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
+    long n;
+    long *raw = utils::nonzero_indices(filter, n);
     long shp[1] = {n};
     return this->fast(
         ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
@@ -0,0 +1,279 @@
+#ifndef PYTHONIC_TYPES_RAGGED_HPP
+#define PYTHONIC_TYPES_RAGGED_HPP
+
+#include "pythonic/include/types/ragged.hpp"
+
+#include "pythonic/types/list.hpp"
+#include "pythonic/types/nditerator.hpp"
+#include "pythonic/types/slice.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/utils/nested_container.hpp"
+#include "pythonic/utils/shared_ref.hpp"
+
+#include <cassert>
+#include <ostream>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+
+  // constructors
+  template <class T>
+  ragged<T>::ragged()
+      : values_(), offsets_(std::size_t(1), 0L)
+  {
+  }
+
+  template <class T>
+  ragged<T>::ragged(empty_list const &)
+      : ragged()
+  {
+  }
+
+  template <class T>
+  template <class Iterable>
+  ragged<T>::ragged(Iterable const &rows)
+      : ragged()
+  {
+    for (auto const &row : rows) {
+      for (auto const &value : row)
+        push_value(value);
+      end_row();
+    }
+  }
+
+  // construction
+  template <class T>
+  void ragged<T>::reserve(long rows, long values)
+  {
+    offsets_->reserve(rows + 1);
+    values_->reserve(values);
+  }
+
+  template <class T>
+  template <class V>
+  void ragged<T>::push_value(V &&value)
+  {
+    values_->push_back(std::forward<V>(value));
+  }
+
+  template <class T>
+  void ragged<T>::end_row()
+  {
+    offsets_->push_back(values_->size());
+  }
+
+  // conversion
+  template <class T>
+  template <class U>
+  ragged<T>::operator list<U>() const
+  {
+    return list<U>(begin(), end());
+  }
+
+  // iterators
+  template <class T>
+  typename ragged<T>::const_iterator ragged<T>::begin() const
+  {
+    return {*this, 0};
+  }
+
+  template <class T>
+  typename ragged<T>::const_iterator ragged<T>::end() const
+  {
+    return {*this, size()};
+  }
+
+  // size
+  template <class T>
+  long ragged<T>::size() const
+  {
+    return offsets_->size() - 1;
+  }
+
+  template <class T>
+  ragged<T>::operator bool() const
+  {
+    return size() != 0;
+  }
+
+  // accessors
+  template <class T>
+  typename ragged<T>::value_type ragged<T>::fast(long i) const
+  {
+    std::vector<long> const &offsets = *offsets_;
+    return {values_,
+            contiguous_normalized_slice(offsets[i], offsets[i + 1])};
+  }
+
+  template <class T>
+  typename ragged<T>::value_type ragged<T>::operator[](long i) const
+  {
+    if (i < 0)
+      i += size();
+    assert(0 <= i && i < size());
+    return fast(i);
+  }
+
+  template <class T>
+  template <class Sp>
+  typename std::enable_if<is_slice<Sp>::value, ragged<T>>::type
+      ragged<T>::operator[](Sp const &s) const
+  {
+    auto ns = s.normalize(size());
+    long n = ns.size();
+    std::vector<long> const &offsets = *offsets_;
+    ragged<T> out;
+    out.offsets_->reserve(n + 1);
+    for (long i = 0; i < n; ++i) {
+      long row = ns.lower + i * ns.step;
+      out.values_->insert(out.values_->end(),
+                          values_->begin() + offsets[row],
+                          values_->begin() + offsets[row + 1]);
+      out.end_row();
+    }
+    return out;
+  }
+
+  template <class T>
+  typename ragged<T>::container_type const &ragged<T>::values() const
+  {
+    return *values_;
+  }
+
+  template <class T>
+  std::vector<long> const &ragged<T>::offsets() const
+  {
+    return *offsets_;
+  }
+
+  // comparison
+  template <class T>
+  bool ragged<T>::operator==(ragged<T> const &other) const
+  {
+    return *offsets_ == *other.offsets_ && *values_ == *other.values_;
+  }
+
+  template <class T>
+  template <class K>
+  bool ragged<T>::operator==(list<K> const &other) const
+  {
+    long n = size();
+    if (n != other.size())
+      return false;
+    for (long i = 0; i < n; ++i)
+      if (!(fast(i) == other.fast(i)))
+        return false;
+    return true;
+  }
+
+  template <class T>
+  bool ragged<T>::operator==(empty_list const &) const
+  {
+    return size() == 0;
+  }
+
+  template <class T>
+  template <class K>
+  bool ragged<T>::operator!=(K const &other) const
+  {
+    return !(*this == other);
+  }
+
+  // other operations
+  template <class T>
+  template <class V>
+  bool ragged<T>::contains(V const &v) const
+  {
+    for (long i = 0, n = size(); i < n; ++i)
+      if (fast(i) == v)
+        return true;
+    return false;
+  }
+
+  template <class T>
+  intptr_t ragged<T>::id() const
+  {
+    return reinterpret_cast<intptr_t>(&(*values_));
+  }
+
+  template <class T>
+  std::ostream &operator<<(std::ostream &os, ragged<T> const &v)
+  {
+    os << '[';
+    for (long i = 0, n = v.size(); i < n; ++i) {
+      if (i)
+        os << ", ";
+      os << v.fast(i);
+    }
+    return os << ']';
+  }
+}
+PYTHONIC_NS_END
+
+namespace std
+{
+  template <size_t I, class T>
+  typename pythonic::types::ragged<T>::value_type
+  get(pythonic::types::ragged<T> const &t)
+  {
+    return t[I];
+  }
+}
+
+#ifdef ENABLE_PYTHON_MODULE
+
+PYTHONIC_NS_BEGIN
+
+template <class T>
+PyObject *to_python<types::ragged<T>>::convert(types::ragged<T> const &v)
+{
+  auto const &values = v.values();
+  auto const &offsets = v.offsets();
+  Py_ssize_t n = v.size();
+  PyObject *ret = PyList_New(n);
+  for (Py_ssize_t i = 0; i < n; ++i) {
+    long start = offsets[i], stop = offsets[i + 1];
+    PyObject *row = PyList_New(stop - start);
+    for (long j = start; j < stop; ++j)
+      PyList_SET_ITEM(row, j - start, ::to_python(values[j]));
+    PyList_SET_ITEM(ret, i, row);
+  }
+  return ret;
+}
+
+template <class T>
+bool from_python<types::ragged<T>>::is_convertible(PyObject *obj)
+{
+  return PyList_Check(obj) &&
+         (PyObject_Not(obj) || ::is_convertible<types::list<T>>(
+                                   PySequence_Fast_GET_ITEM(obj, 0)));
+}
+
+template <class T>
+types::ragged<T> from_python<types::ragged<T>>::convert(PyObject *obj)
+{
+  Py_ssize_t n = PySequence_Fast_GET_SIZE(obj);
+  PyObject **rows = PySequence_Fast_ITEMS(obj);
+
+  Py_ssize_t total = 0;
+  for (Py_ssize_t i = 0; i < n; ++i)
+    total += PySequence_Fast_GET_SIZE(rows[i]);
+
+  types::ragged<T> v;
+  v.reserve(n, total);
+  for (Py_ssize_t i = 0; i < n; ++i) {
+    Py_ssize_t l = PySequence_Fast_GET_SIZE(rows[i]);
+    PyObject **items = PySequence_Fast_ITEMS(rows[i]);
+    for (Py_ssize_t j = 0; j < l; ++j)
+      v.push_value(::from_python<T>(items[j]));
+    v.end_row();
+  }
+  return v;
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -48,6 +48,12 @@ namespace types
   {
     external = true;
   }
+
+  template <class T>
+  bool raw_array<T>::is_external() const
+  {
+    return external;
+  }
 }
 PYTHONIC_NS_END
 
@@ -119,8 +119,6 @@ namespace types
         // conditional processing doesn't permit SIMD
         !std::is_same<O, numpy::functor::nan_to_num>::value &&
         !std::is_same<O, numpy::functor::asarray_chkfinite>::value &&
-        !std::is_same<O, numpy::functor::clip>::value &&
-        !std::is_same<O, numpy::functor::where>::value &&
         // not supported by xsimd
         !std::is_same<O, numpy::functor::nextafter>::value &&
         !std::is_same<O, numpy::functor::spacing>::value &&
@@ -128,6 +126,8 @@ namespace types
         !(utils::any_of<
               is_complex<typename dtype_of<Args>::type>::value...>::value &&
           (std::is_same<O, numpy::functor::floor_divide>::value ||
+           std::is_same<O, numpy::functor::clip>::value ||
+           std::is_same<O, numpy::functor::where>::value ||
            std::is_same<O, numpy::functor::maximum>::value ||
            std::is_same<O, builtins::pythran::functor::abssqr>::value ||
            std::is_same<O, numpy::functor::minimum>::value)) &&
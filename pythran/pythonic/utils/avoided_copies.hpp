@@ -0,0 +1,42 @@
+#ifndef PYTHONIC_UTILS_AVOIDED_COPIES_HPP
+#define PYTHONIC_UTILS_AVOIDED_COPIES_HPP
+
+#include "pythonic/include/utils/avoided_copies.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+#ifdef PYTHRAN_COUNT_AVOIDED_COPIES
+  namespace details
+  {
+    std::atomic<long> &avoided_copies_counter()
+    {
+      static std::atomic<long> counter(0);
+      return counter;
+    }
+  }
+
+  void count_avoided_copy()
+  {
+    ++details::avoided_copies_counter();
+  }
+
+  long avoided_copies()
+  {
+    return details::avoided_copies_counter();
+  }
+#else
+  void count_avoided_copy()
+  {
+  }
+
+  long avoided_copies()
+  {
+    return 0;
+  }
+#endif
+}
+PYTHONIC_NS_END
+
+#endif
@@ -13,6 +13,11 @@
 #define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
 #endif
 
+// size of the blocks the flattened iteration space is split into
+#ifndef PYTHRAN_FLAT_CHUNK_BYTES
+#define PYTHRAN_FLAT_CHUNK_BYTES 16384
+#endif
+
 #endif
 
 PYTHONIC_NS_BEGIN
@@ -48,69 +53,120 @@ namespace utils
   template <typename vector_form, size_t N, size_t D>
   struct _broadcast_copy;
 
-  struct fast_novectorize {
+  /* Evaluation of an expression that does not need broadcasting (apart from
+   * its ``D'' leading dimensions) over the collapsed iteration space of
+   * ``self''.
+   *
+   * The flat range [0, self.flat_size()) is split into chunks of about
+   * PYTHRAN_FLAT_CHUNK_BYTES bytes that are distributed among threads. Each
+   * chunk walks its multi-index like an odometer and runs a plain loop on the
+   * innermost dimension, so that neither the number of rows nor their length
+   * limits parallelism.
+   *
+   * ``Store'' performs the elementwise action, either a copy or an update.
+   */
+  template <class Store, size_t N, size_t D>
+  struct _flat_broadcast {
+    template <class E, class F>
+    void operator()(E &&self, F const &other)
+    {
+      using broadcaster = typename std::conditional<
+          types::is_dtype<F>::value,
+          types::broadcast<F, typename std::decay<E>::type::dtype>,
+          types::broadcasted<F>>::type;
+      _flat_broadcast<Store, N, D - 1>{}(std::forward<E>(self),
+                                         broadcaster(other));
+    }
   };
 
-  template <>
-  struct _broadcast_copy<fast_novectorize, 0, 0> {
-    template <class E, class F, class SelfIndices, class OtherIndices,
-              size_t... Is>
-    void helper(E &&self, F const &other, SelfIndices &&self_indices,
-                OtherIndices &&other_indices, utils::index_sequence<Is...>)
+  template <class Store, size_t N>
+  struct _flat_broadcast<Store, N, 0> {
+
+    template <class E, class F, size_t... Is>
+    static void row(E &self, F const &other, types::array<long, N> const &sidx,
+                    types::array<long, N> const &oidx, long ostep, long start,
+                    long stop, utils::index_sequence<Is...>)
+    {
+      for (long j = start; j < stop; ++j)
+        Store{}(self, other.load(oidx[Is]..., j * ostep), sidx[Is]..., j);
+    }
+
+    template <class E, class F>
+    static void chunk(E &self, F const &other,
+                      types::array<long, N> const &shape,
+                      types::array<long, N> const &steps, long first,
+                      long last)
     {
-      self.store((typename std::decay<E>::type::dtype)other.load(
-                     (long)std::get<Is>(other_indices)...),
-                 (long)std::get<Is>(self_indices)...);
+      types::array<long, N> sidx, oidx;
+      for (long k = N - 1, flat = first; k >= 0; --k) {
+        sidx[k] = flat % shape[k];
+        oidx[k] = sidx[k] * steps[k];
+        flat /= shape[k];
+      }
+      long const inner = shape[N - 1];
+      while (first < last) {
+        long const start = sidx[N - 1];
+        long const stop = std::min(inner, start + (last - first));
+        row(self, other, sidx, oidx, steps[N - 1], start, stop,
+            utils::make_index_sequence<N - 1>());
+        first += stop - start;
+        sidx[N - 1] = 0;
+        for (long k = (long)N - 2; k >= 0; --k) {
+          if (++sidx[k] < shape[k]) {
+            oidx[k] = sidx[k] * steps[k];
+            break;
+          }
+          sidx[k] = oidx[k] = 0;
+        }
+      }
     }
 
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
+    template <class E, class F, size_t... Is>
+    static types::array<long, N> make_steps(E const &self, F const &other,
+                                            utils::index_sequence<Is...>)
+    {
+      return {{(long)(other.template shape<Is>() ==
+                      self.template shape<Is>())...}};
+    }
+
+    template <class E, class F>
+    void operator()(E &&self, F const &other)
     {
-      helper(std::forward<E>(self), other, self_indices, other_indices,
-             utils::make_index_sequence<std::tuple_size<
-                 typename std::decay<SelfIndices>::type>::value>());
+      auto const shape = sutils::array(sutils::getshape(self));
+      auto const steps =
+          make_steps(self, other, utils::make_index_sequence<N>());
+      long const total = self.flat_size();
+#ifdef _OPENMP
+      using dtype = typename std::decay<E>::type::dtype;
+      if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+          total >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+        long const chunk_size =
+            std::max(1L, (long)(PYTHRAN_FLAT_CHUNK_BYTES / sizeof(dtype)));
+        long const nchunks = (total + chunk_size - 1) / chunk_size;
+#pragma omp parallel for
+        for (long c = 0; c < nchunks; ++c)
+          chunk(self, other, shape, steps, c * chunk_size,
+                std::min(total, (c + 1) * chunk_size));
+      } else
+#endif
+        chunk(self, other, shape, steps, 0, total);
     }
   };
-  template <size_t N>
-  struct _broadcast_copy<fast_novectorize, N, 0> {
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
+
+  struct flat_copy {
+    template <class E, class V, class... Indices>
+    void operator()(E &self, V value, Indices... indices) const
     {
-      auto const other_size =
-          other.template shape<std::decay<E>::type::value - N>();
-      auto const self_size =
-          self.template shape<std::decay<E>::type::value - N>();
-      if (self_size == other_size)
-        for (long i = 0; i < self_size; ++i)
-          _broadcast_copy<fast_novectorize, N - 1, 0>{}(
-              std::forward<E>(self), other,
-              std::tuple_cat(self_indices, std::make_tuple(i)),
-              std::tuple_cat(other_indices, std::make_tuple(i)));
-      else
-        for (long i = 0; i < self_size; ++i)
-          _broadcast_copy<fast_novectorize, N - 1, 0>{}(
-              std::forward<E>(self), other,
-              std::tuple_cat(self_indices, std::make_tuple(i)),
-              std::tuple_cat(other_indices, std::make_tuple(0)));
+      self.store((typename std::decay<E>::type::dtype)value, indices...);
     }
   };
 
-  template <size_t N, size_t D>
-  struct _broadcast_copy<fast_novectorize, N, D> {
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
+  template <class Op>
+  struct flat_update {
+    template <class E, class V, class... Indices>
+    void operator()(E &self, V value, Indices... indices) const
     {
-      using broadcaster = typename std::conditional<
-          types::is_dtype<F>::value,
-          types::broadcast<F, typename std::decay<E>::type::dtype>,
-          types::broadcasted<F>>::type;
-      _broadcast_copy<fast_novectorize, N, D - 1>{}(
-          std::forward<E>(self), broadcaster(other),
-          std::forward<SelfIndices>(self_indices),
-          std::forward<OtherIndices>(other_indices));
+      self.template update<Op>(value, indices...);
     }
   };
 
@@ -122,7 +178,8 @@ namespace utils
       long self_size = std::distance(self.begin(), self.end()),
            other_size = std::distance(other.begin(), other.end());
 #ifdef _OPENMP
-      if (other_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+      if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+          other_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
         auto siter = self.begin();
         auto oiter = other.begin();
 #pragma omp parallel for
@@ -208,7 +265,8 @@ namespace utils
         std::distance(vectorizer::vbegin(other), vectorizer::vend(other));
 
 #ifdef _OPENMP
-    if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+    if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+        bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
       auto iter = vectorizer::vbegin(self);
 #pragma omp parallel for
       for (long i = 0; i < bound; ++i) {
@@ -258,6 +316,28 @@ namespace utils
   };
 
 #endif
+  /* One-dimensional indexed views assigned from an expression of the same
+   * size go through the SIMD iterators, which gather and scatter.
+   */
+  template <bool indexed>
+  struct _gather_scatter {
+    template <class E, class F>
+    static bool applies(E const &, F const &)
+    {
+      return false;
+    }
+  };
+
+  template <>
+  struct _gather_scatter<true> {
+    template <class E, class F>
+    static bool applies(E const &self, F const &other)
+    {
+      return utils::no_broadcast_ex(other) &&
+             self.template shape<0>() == other.template shape<0>();
+    }
+  };
+
   template <class E, class F, size_t N, size_t D, bool vector_form>
   struct broadcast_copy_dispatcher;
 
@@ -266,8 +346,7 @@ namespace utils
     void operator()(E &self, F const &other)
     {
       if (utils::no_broadcast_ex(other))
-        _broadcast_copy<fast_novectorize, N, D>{}(
-            self, other, std::make_tuple(), std::make_tuple());
+        _flat_broadcast<flat_copy, N, D>{}(self, other);
       else
         _broadcast_copy<types::novectorize, N, D>{}(self, other);
     }
@@ -276,9 +355,14 @@ namespace utils
   struct broadcast_copy_dispatcher<E, F, N, D, true> {
     void operator()(E &self, F const &other)
     {
-      if (utils::no_broadcast_ex(other))
-        _broadcast_copy<fast_novectorize, N, D>{}(
-            self, other, std::make_tuple(), std::make_tuple());
+      // gather / scatter to and from indexed views
+      if (_gather_scatter<N == 1 && D == 0 &&
+                          has_aliased_positions<
+                              typename std::decay<E>::type>::value>::
+              applies(self, other))
+        _broadcast_copy<types::vectorizer_nobroadcast, N, D>{}(self, other);
+      else if (utils::no_broadcast_ex(other))
+        _flat_broadcast<flat_copy, N, D>{}(self, other);
       else
         _broadcast_copy<types::vectorizer, N, D>{}(self, other);
     }
@@ -304,7 +388,8 @@ namespace utils
       long n = self.template shape<0>();
       auto siter = self.begin();
 #ifdef _OPENMP
-      if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+      if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+          n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
 #pragma omp parallel for
         for (long i = 0; i < n; ++i)
           Op{}(*(siter + i), other);
@@ -324,7 +409,8 @@ namespace utils
       auto siter = self.begin();
       auto oiter = other.begin();
 #ifdef _OPENMP
-      if (other_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+      if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+          other_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
 #pragma omp parallel for
         for (long i = 0; i < other_size; ++i)
           Op{}(*(siter + i), *(oiter + i));
@@ -359,67 +445,6 @@ namespace utils
     }
   };
 
-  template <class Op>
-  struct _broadcast_update<Op, fast_novectorize, 0, 0> {
-    template <class E, class F, class SelfIndices, class OtherIndices,
-              size_t... Is>
-    void helper(E &&self, F const &other, SelfIndices &&self_indices,
-                OtherIndices &&other_indices, utils::index_sequence<Is...>)
-    {
-      self.template update<Op>(other.load((long)std::get<Is>(other_indices)...),
-                               (long)std::get<Is>(self_indices)...);
-    }
-
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
-    {
-      helper(std::forward<E>(self), other, self_indices, other_indices,
-             utils::make_index_sequence<std::tuple_size<
-                 typename std::decay<SelfIndices>::type>::value>());
-    }
-  };
-  template <class Op, size_t N>
-  struct _broadcast_update<Op, fast_novectorize, N, 0> {
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
-    {
-      auto const other_size =
-          other.template shape<std::decay<E>::type::value - N>();
-      auto const self_size =
-          self.template shape<std::decay<E>::type::value - N>();
-      if (self_size == other_size)
-        for (long i = 0; i < self_size; ++i)
-          _broadcast_update<Op, fast_novectorize, N - 1, 0>{}(
-              std::forward<E>(self), other,
-              std::tuple_cat(self_indices, std::make_tuple(i)),
-              std::tuple_cat(other_indices, std::make_tuple(i)));
-      else
-        for (long i = 0; i < self_size; ++i)
-          _broadcast_update<Op, fast_novectorize, N - 1, 0>{}(
-              std::forward<E>(self), other,
-              std::tuple_cat(self_indices, std::make_tuple(i)),
-              std::tuple_cat(other_indices, std::make_tuple(0)));
-    }
-  };
-  template <class Op, size_t N, size_t D>
-  struct _broadcast_update<Op, fast_novectorize, N, D> {
-    template <class E, class F, class SelfIndices, class OtherIndices>
-    void operator()(E &&self, F const &other, SelfIndices &&self_indices,
-                    OtherIndices &&other_indices)
-    {
-      using broadcaster = typename std::conditional<
-          types::is_dtype<F>::value,
-          types::broadcast<F, typename std::decay<E>::type::dtype>,
-          types::broadcasted<F>>::type;
-      _broadcast_update<Op, fast_novectorize, N, D - 1>{}(
-          std::forward<E>(self), broadcaster(other),
-          std::forward<SelfIndices>(self_indices),
-          std::forward<OtherIndices>(other_indices));
-    }
-  };
-
 #ifdef USE_XSIMD
   // specialize for SIMD only if available
   // otherwise use the std::copy fallback
@@ -438,15 +463,16 @@ namespace utils
         std::distance(vectorizer::vbegin(other), vectorizer::vend(other));
 
 #ifdef _OPENMP
-    if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+    if (!has_aliased_positions<typename std::decay<E>::type>::value &&
+        bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
 #pragma omp parallel for
       for (long i = 0; i < bound; i++) {
-        (iter + i).store(Op{}(*(iter + i), *(oiter + i)));
+        (iter + i).template update<Op>(*(oiter + i));
       }
     else
 #endif
       for (auto end = vectorizer::vend(self); iter != end; ++iter, ++oiter) {
-        iter.store(Op{}(*iter, *oiter));
+        iter.template update<Op>(*oiter);
       }
     // tail
     {
@@ -500,8 +526,7 @@ namespace utils
     void operator()(E &self, F const &other)
     {
       if (utils::no_broadcast_ex(other))
-        _broadcast_update<Op, fast_novectorize, N, D>{}(
-            self, other, std::make_tuple(), std::make_tuple());
+        _flat_broadcast<flat_update<Op>, N, D>{}(self, other);
       else
         _broadcast_update<Op, types::novectorize, N, D>{}(self, other);
     }
@@ -510,9 +535,15 @@ namespace utils
   struct broadcast_update_dispatcher<Op, true, E, F, N, D> {
     void operator()(E &self, F const &other)
     {
-      if (utils::no_broadcast_ex(other))
-        _broadcast_update<Op, fast_novectorize, N, D>{}(
-            self, other, std::make_tuple(), std::make_tuple());
+      // gather / scatter to and from indexed views
+      if (_gather_scatter<N == 1 && D == 0 &&
+                          has_aliased_positions<
+                              typename std::decay<E>::type>::value>::
+              applies(self, other))
+        _broadcast_update<Op, types::vectorizer_nobroadcast, N, D>{}(self,
+                                                                     other);
+      else if (utils::no_broadcast_ex(other))
+        _flat_broadcast<flat_update<Op>, N, D>{}(self, other);
       else
         _broadcast_update<Op, types::vectorizer, N, D>{}(self, other);
     }
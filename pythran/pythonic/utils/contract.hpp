@@ -0,0 +1,301 @@
+#ifndef PYTHONIC_UTILS_CONTRACT_HPP
+#define PYTHONIC_UTILS_CONTRACT_HPP
+
+#include "pythonic/include/utils/contract.hpp"
+
+#include "pythonic/numpy/dot.hpp"
+
+#include <algorithm>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+#define GEMM_DEF(T, L)                                                         \
+  void gemm(bool transa, bool transb, long m, long n, long k, T const *A,      \
+            T const *B, T *C)                                                  \
+  {                                                                            \
+    cblas_##L##gemm(CblasRowMajor, transa ? CblasTrans : CblasNoTrans,         \
+                    transb ? CblasTrans : CblasNoTrans, m, n, k, 1, A,         \
+                    std::max(1L, transa ? m : k), B,                           \
+                    std::max(1L, transb ? k : n), 0, C, std::max(1L, n));      \
+  }
+  GEMM_DEF(double, d)
+  GEMM_DEF(float, s)
+#undef GEMM_DEF
+#define GEMM_DEF(T, K, L)                                                      \
+  void gemm(bool transa, bool transb, long m, long n, long k, T const *A,      \
+            T const *B, T *C)                                                  \
+  {                                                                            \
+    T alpha = 1, beta = 0;                                                     \
+    cblas_##L##gemm(CblasRowMajor, transa ? CblasTrans : CblasNoTrans,         \
+                    transb ? CblasTrans : CblasNoTrans, m, n, k,               \
+                    (K const *)&alpha, (K const *)A,                           \
+                    std::max(1L, transa ? m : k), (K const *)B,                \
+                    std::max(1L, transb ? k : n), (K const *)&beta, (K *)C,    \
+                    std::max(1L, n));                                          \
+  }
+  GEMM_DEF(std::complex<float>, float, c)
+  GEMM_DEF(std::complex<double>, double, z)
+#undef GEMM_DEF
+
+  template <class T>
+  void gemm(bool transa, bool transb, long m, long n, long k, T const *A,
+            T const *B, T *C)
+  {
+    std::fill(C, C + m * n, T(0));
+    long sa_i = transa ? 1 : k, sa_p = transa ? m : 1;
+    long sb_p = transb ? 1 : n, sb_j = transb ? k : 1;
+    // i-p-j order: the innermost loop streams through rows of C
+    for (long i = 0; i < m; ++i)
+      for (long p = 0; p < k; ++p) {
+        T a = A[i * sa_i + p * sa_p];
+        T const *b = B + p * sb_p;
+        T *c = C + i * n;
+        for (long j = 0; j < n; ++j)
+          c[j] += a * b[j * sb_j];
+      }
+  }
+
+  template <class T>
+  long tensor<T>::size() const
+  {
+    long n = 1;
+    for (long s : shape)
+      n *= s;
+    return n;
+  }
+
+  namespace details
+  {
+    template <class L>
+    long find_label(L const &labels, int label)
+    {
+      return std::find(labels.begin(), labels.end(), label) - labels.begin();
+    }
+
+    template <class L>
+    bool has_label(L const &labels, int label)
+    {
+      return find_label(labels, label) != (long)labels.size();
+    }
+
+    std::vector<int> concat(std::vector<int> a, std::vector<int> const &b,
+                            std::vector<int> const &c)
+    {
+      a.insert(a.end(), b.begin(), b.end());
+      a.insert(a.end(), c.begin(), c.end());
+      return a;
+    }
+
+    long product(std::vector<long> const &dims)
+    {
+      long n = 1;
+      for (long d : dims)
+        n *= d;
+      return n;
+    }
+  }
+
+  template <class T>
+  tensor<T> reduce(tensor<T> in, std::vector<int> const &labels)
+  {
+    if (in.labels == labels)
+      return in;
+
+    long rank = in.shape.size();
+    std::vector<long> strides(rank);
+    for (long d = rank - 1, s = 1; d >= 0; s *= in.shape[d--])
+      strides[d] = s;
+
+    // a repeated label walks the diagonal, with the sum of its strides
+    std::vector<int> uniq;
+    std::vector<long> dims, ustrides;
+    for (long d = 0; d < rank; ++d) {
+      long p = details::find_label(uniq, in.labels[d]);
+      if (p == (long)uniq.size()) {
+        uniq.push_back(in.labels[d]);
+        dims.push_back(in.shape[d]);
+        ustrides.push_back(strides[d]);
+      } else
+        ustrides[p] += strides[d];
+    }
+
+    std::vector<long> odims, ostrides, sdims, sstrides;
+    for (int label : labels) {
+      long p = details::find_label(uniq, label);
+      odims.push_back(dims[p]);
+      ostrides.push_back(ustrides[p]);
+    }
+    for (size_t p = 0; p < uniq.size(); ++p)
+      if (!details::has_label(labels, uniq[p])) {
+        sdims.push_back(dims[p]);
+        sstrides.push_back(ustrides[p]);
+      }
+
+    // offsets of the summed elements, but for the last summed axis which is
+    // walked in the inner loop
+    long last_dim = 1, last_stride = 0;
+    if (!sdims.empty()) {
+      last_dim = sdims.back();
+      last_stride = sstrides.back();
+      sdims.pop_back();
+      sstrides.pop_back();
+    }
+    std::vector<long> soffsets(details::product(sdims));
+    for (long j = 0; j < (long)soffsets.size(); ++j) {
+      long offset = 0;
+      for (long d = sdims.size() - 1, r = j; d >= 0; r /= sdims[d--])
+        offset += (r % sdims[d]) * sstrides[d];
+      soffsets[j] = offset;
+    }
+
+    tensor<T> out;
+    out.shape = odims;
+    out.labels = labels;
+    out.storage.resize(details::product(odims));
+    out.data = out.storage.data();
+    long osize = out.storage.size();
+    T const *src = in.data;
+    T *dst = out.storage.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (osize * (long)soffsets.size() * last_dim >=      \
+                             PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long i = 0; i < osize; ++i) {
+      long base = 0;
+      for (long d = odims.size() - 1, r = i; d >= 0; r /= odims[d--])
+        base += (r % odims[d]) * ostrides[d];
+      T acc = T(0);
+      for (long offset : soffsets) {
+        T const *s = src + base + offset;
+        for (long l = 0; l < last_dim; ++l)
+          acc += s[l * last_stride];
+      }
+      dst[i] = acc;
+    }
+    return out;
+  }
+
+  template <class T>
+  tensor<T> contract(tensor<T> a, tensor<T> b, std::vector<int> const &keep)
+  {
+    std::vector<int> batch, summed, afree, bfree;
+    for (int label : a.labels)
+      if (details::has_label(b.labels, label))
+        (details::has_label(keep, label) ? batch : summed).push_back(label);
+      else if (details::has_label(keep, label))
+        afree.push_back(label);
+    for (int label : b.labels)
+      if (!details::has_label(a.labels, label) &&
+          details::has_label(keep, label))
+        bfree.push_back(label);
+
+    // Use the operands as they are when their layout is that of a batch of
+    // matrices, possibly transposed, and permute them otherwise.
+    bool transa = false, transb = false;
+    if (a.labels == details::concat(batch, summed, afree))
+      transa = true;
+    else
+      a = reduce(std::move(a), details::concat(batch, afree, summed));
+    if (b.labels == details::concat(batch, bfree, summed))
+      transb = true;
+    else
+      b = reduce(std::move(b), details::concat(batch, summed, bfree));
+
+    auto extent = [&](tensor<T> const &t, std::vector<int> const &labels) {
+      long n = 1;
+      for (int label : labels)
+        n *= t.shape[details::find_label(t.labels, label)];
+      return n;
+    };
+    long nbatch = extent(a, batch), m = extent(a, afree), k = extent(a, summed),
+         n = extent(b, bfree);
+
+    tensor<T> out;
+    out.labels = details::concat(batch, afree, bfree);
+    for (int label : out.labels)
+      out.shape.push_back(
+          details::has_label(a.labels, label)
+              ? a.shape[details::find_label(a.labels, label)]
+              : b.shape[details::find_label(b.labels, label)]);
+    out.storage.resize(nbatch * m * n);
+    out.data = out.storage.data();
+    T const *A = a.data, *B = b.data;
+    T *C = out.storage.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (nbatch > 1 &&                                     \
+                             nbatch * m * n * k >=                             \
+                                 PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long i = 0; i < nbatch; ++i)
+      gemm(transa, transb, m, n, k, A + i * m * k, B + i * k * n,
+           C + i * m * n);
+    return out;
+  }
+
+  template <class T>
+  tensor<T> contract_all(std::vector<tensor<T>> operands,
+                         std::vector<int> const &labels,
+                         std::vector<long> const &extents)
+  {
+    // labels needed once operands other than those in `skip' are merged
+    auto needed = [&](long skip0, long skip1) {
+      std::vector<int> keep = labels;
+      for (long i = 0; i < (long)operands.size(); ++i)
+        if (i != skip0 && i != skip1)
+          for (int label : operands[i].labels)
+            if (!details::has_label(keep, label))
+              keep.push_back(label);
+      return keep;
+    };
+
+    // diagonals and sums that only involve a single operand come first
+    for (long i = 0; i < (long)operands.size(); ++i) {
+      std::vector<int> keep = needed(i, i), kept;
+      for (int label : operands[i].labels)
+        if (details::has_label(keep, label) && !details::has_label(kept, label))
+          kept.push_back(label);
+      operands[i] = reduce(std::move(operands[i]), kept);
+    }
+
+    while (operands.size() > 1) {
+      long best0 = 0, best1 = 1;
+      double best_size = -1, best_cost = -1;
+      for (long i = 0; i < (long)operands.size(); ++i)
+        for (long j = i + 1; j < (long)operands.size(); ++j) {
+          std::vector<int> keep = needed(i, j);
+          double size = 1, cost = 1;
+          for (int label : operands[i].labels) {
+            cost *= extents[label];
+            if (details::has_label(keep, label))
+              size *= extents[label];
+          }
+          for (int label : operands[j].labels)
+            if (!details::has_label(operands[i].labels, label)) {
+              cost *= extents[label];
+              if (details::has_label(keep, label))
+                size *= extents[label];
+            }
+          if (best_size < 0 || size < best_size ||
+              (size == best_size && cost < best_cost)) {
+            best0 = i;
+            best1 = j;
+            best_size = size;
+            best_cost = cost;
+          }
+        }
+      std::vector<int> keep = needed(best0, best1);
+      tensor<T> merged = contract(std::move(operands[best0]),
+                                  std::move(operands[best1]), keep);
+      operands.erase(operands.begin() + best1);
+      operands.erase(operands.begin() + best0);
+      operands.push_back(std::move(merged));
+    }
+    return reduce(std::move(operands.front()), labels);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef PYTHONIC_UTILS_HISTOGRAM_HPP
+#define PYTHONIC_UTILS_HISTOGRAM_HPP
+
+#include "pythonic/include/utils/histogram.hpp"
+
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/searchsorted.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace details
+  {
+    template <class T>
+    bool minmax_block(T const *data, long n, T &lo, T &hi)
+    {
+      T l = data[0], h = data[0];
+      bool nan = data[0] != data[0];
+      for (long i = 1; i < n; ++i) {
+        T v = data[i];
+        nan |= v != v;
+        l = v < l ? v : l;
+        h = h < v ? v : h;
+      }
+      lo = l;
+      hi = h;
+      return !nan;
+    }
+  }
+
+  template <class T>
+  bool minmax(T const *data, long n, T &lo, T &hi)
+  {
+#ifdef _OPENMP
+    constexpr long B = PYTHRAN_HISTOGRAM_BLOCK_SIZE;
+    long nblocks = (n + B - 1) / B;
+    if (nblocks > 1 && omp_get_max_threads() > 1) {
+      std::vector<T> los(nblocks), his(nblocks);
+      std::vector<char> oks(nblocks);
+#pragma omp parallel for
+      for (long b = 0; b < nblocks; ++b) {
+        long beg = b * B, end = std::min(n, beg + B);
+        oks[b] = details::minmax_block(data + beg, end - beg, los[b], his[b]);
+      }
+      lo = *std::min_element(los.begin(), los.end());
+      hi = *std::max_element(his.begin(), his.end());
+      return std::find(oks.begin(), oks.end(), 0) == oks.end();
+    }
+#endif
+    return details::minmax_block(data, n, lo, hi);
+  }
+
+  binner::binner(double lo, double hi, long nbins)
+      : edges_(nbins + 1), uniform_(true), norm_(nbins / (hi - lo))
+  {
+    // same edges as numpy.linspace
+    double step = (hi - lo) / nbins;
+    for (long i = 0; i < nbins; ++i)
+      edges_[i] = lo + i * step;
+    edges_[nbins] = hi;
+  }
+
+  template <class T>
+  binner::binner(T const *edges, long nedges)
+      : edges_(edges, edges + nedges), uniform_(false), norm_(0)
+  {
+    if (nedges < 2)
+      throw types::ValueError("`bins` must have at least two edges");
+    for (long i = 1; i < nedges; ++i)
+      if (edges_[i] < edges_[i - 1])
+        throw types::ValueError(
+            "`bins` must increase monotonically, when an array");
+  }
+
+  long binner::size() const
+  {
+    return edges_.size() - 1;
+  }
+
+  std::vector<double> const &binner::edges() const
+  {
+    return edges_;
+  }
+
+  template <class V>
+  long binner::operator()(V const &value) const
+  {
+    double v = value;
+    long nbins = edges_.size() - 1;
+    // also discards NaN
+    if (!(v >= edges_.front() && v <= edges_.back()))
+      return -1;
+    if (uniform_) {
+      // the arithmetic guess may be one bin off near the edges
+      long k = std::min(static_cast<long>((v - edges_[0]) * norm_), nbins - 1);
+      if (v < edges_[k])
+        --k;
+      else if (k != nbins - 1 && v >= edges_[k + 1])
+        ++k;
+      return k;
+    } else {
+      long k = search_sorted(search_right{}, edges_.data(), nbins + 1, v);
+      return std::min(k - 1, nbins - 1);
+    }
+  }
+
+  template <class T>
+  void histogram_range(T const *data, long n, double &lo, double &hi)
+  {
+    if (n == 0) {
+      lo = 0;
+      hi = 1;
+      return;
+    }
+    T l, h;
+    if (!minmax(data, n, l, h) || !std::isfinite((double)l) ||
+        !std::isfinite((double)h))
+      throw types::ValueError("autodetected range is not finite");
+    lo = l;
+    hi = h;
+    histogram_range(lo, hi);
+  }
+
+  void histogram_range(double &lo, double &hi)
+  {
+    if (lo > hi)
+      throw types::ValueError("max must be larger than min in range parameter");
+    if (!std::isfinite(lo) || !std::isfinite(hi))
+      throw types::ValueError("supplied range is not finite");
+    if (lo == hi) {
+      lo -= 0.5;
+      hi += 0.5;
+    }
+  }
+
+  long unit_weight::operator()(long) const
+  {
+    return 1;
+  }
+
+  template <class T>
+  T array_weight<T>::operator()(long i) const
+  {
+    return data[i];
+  }
+
+  template <class C, class Index, class Weight>
+  void accumulate_bins(long n, long nbins, Index const &index,
+                       Weight const &weight, C *out)
+  {
+#ifdef _OPENMP
+    long nthreads = omp_get_max_threads();
+    // private bins only pay off when there are more values than bins
+    if (n > PYTHRAN_HISTOGRAM_BLOCK_SIZE && nthreads > 1 &&
+        nbins * nthreads <= n) {
+      std::vector<C> bins(nthreads * nbins, C());
+#pragma omp parallel
+      {
+        C *local = bins.data() + omp_get_thread_num() * nbins;
+#pragma omp for
+        for (long i = 0; i < n; ++i) {
+          long k = index(i);
+          if (k >= 0)
+            local[k] += weight(i);
+        }
+      }
+      // merged in thread order, so that the result does not depend on
+      // scheduling
+      for (long t = 0; t < nthreads; ++t)
+        for (long k = 0; k < nbins; ++k)
+          out[k] += bins[t * nbins + k];
+      return;
+    }
+#else
+    (void)nbins;
+#endif
+    for (long i = 0; i < n; ++i) {
+      long k = index(i);
+      if (k >= 0)
+        out[k] += weight(i);
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
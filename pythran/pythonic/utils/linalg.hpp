@@ -0,0 +1,379 @@
+#ifndef PYTHONIC_UTILS_LINALG_HPP
+#define PYTHONIC_UTILS_LINALG_HPP
+
+#include "pythonic/include/utils/linalg.hpp"
+
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/numpy/dot.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+#define LINALG_BLAS_DEF(T, K, L, R, PTR)                                      \
+  void gemm_sub(CBLAS_TRANSPOSE transb, long m, long n, long k, T const *A,   \
+                long lda, T const *B, long ldb, T *C, long ldc)               \
+  {                                                                           \
+    /* C -= A op(B) */                                                        \
+    T alpha = -1, beta = 1;                                                   \
+    cblas_##L##gemm(CblasRowMajor, CblasNoTrans, transb, m, n, k,             \
+                    PTR(alpha), (K const *)A, lda, (K const *)B, ldb,         \
+                    PTR(beta), (K *)C, ldc);                                  \
+  }                                                                           \
+  void herk_sub(long n, long k, T const *A, long lda, T *C, long ldc)         \
+  {                                                                           \
+    /* lower triangle of C -= A A^H */                                        \
+    cblas_##L##R(CblasRowMajor, CblasLower, CblasNoTrans, n, k, -1,           \
+                 (K const *)A, lda, 1, (K *)C, ldc);                          \
+  }                                                                           \
+  void trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,          \
+            CBLAS_DIAG diag, long m, long n, T const *A, long lda, T *B,      \
+            long ldb)                                                         \
+  {                                                                           \
+    T alpha = 1;                                                              \
+    cblas_##L##trsm(CblasRowMajor, side, uplo, trans, diag, m, n, PTR(alpha), \
+                    (K const *)A, lda, (K *)B, ldb);                          \
+  }                                                                           \
+  void syrk(long n, T const *A, T *C)                                         \
+  {                                                                           \
+    /* lower triangle of C = A A^T */                                         \
+    T alpha = 1, beta = 0;                                                    \
+    cblas_##L##syrk(CblasRowMajor, CblasLower, CblasNoTrans, n, n,            \
+                    PTR(alpha), (K const *)A, n, PTR(beta), (K *)C, n);       \
+  }                                                                           \
+  void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, long m, long n, T const *A,     \
+            T *B)                                                             \
+  {                                                                           \
+    /* B = A B or B A, A being triangular */                                  \
+    T alpha = 1;                                                              \
+    long lda = side == CblasLeft ? m : n;                                     \
+    cblas_##L##trmm(CblasRowMajor, side, uplo, CblasNoTrans, CblasNonUnit, m, \
+                    n, PTR(alpha), (K const *)A, lda, (K *)B, n);             \
+  }
+#define LINALG_VALUE(x) x
+#define LINALG_POINTER(x) &x
+    LINALG_BLAS_DEF(double, double, d, syrk, LINALG_VALUE)
+    LINALG_BLAS_DEF(float, float, s, syrk, LINALG_VALUE)
+    LINALG_BLAS_DEF(std::complex<double>, double, z, herk, LINALG_POINTER)
+    LINALG_BLAS_DEF(std::complex<float>, float, c, herk, LINALG_POINTER)
+#undef LINALG_VALUE
+#undef LINALG_POINTER
+#undef LINALG_BLAS_DEF
+
+    template <class T>
+    T conjugate(T const &v)
+    {
+      return v;
+    }
+    template <class T>
+    std::complex<T> conjugate(std::complex<T> const &v)
+    {
+      return std::conj(v);
+    }
+
+    template <class T>
+    double real_part(T const &v)
+    {
+      return v;
+    }
+    template <class T>
+    T real_part(std::complex<T> const &v)
+    {
+      return v.real();
+    }
+
+    // Unblocked factorization of the columns [j0, jend) of a, swapping
+    // whole rows and updating the columns of the panel only.
+    template <class T, class N, class J>
+    long lu_panel(T *a, N n, long j0, J jend, long *piv)
+    {
+      for (long j = j0; j < jend; ++j) {
+        long p = j;
+        auto best = std::abs(a[j * n + j]);
+        for (long i = j + 1; i < n; ++i) {
+          auto v = std::abs(a[i * n + j]);
+          if (v > best) {
+            best = v;
+            p = i;
+          }
+        }
+        piv[j] = p;
+        if (best == 0)
+          return j + 1;
+        if (p != j)
+          std::swap_ranges(a + j * n, a + (j + 1) * n, a + p * n);
+
+        T const *pivot_row = a + j * n;
+        T inv = T(1) / pivot_row[j];
+        for (long i = j + 1; i < n; ++i) {
+          T *row = a + i * n;
+          T l = row[j] *= inv;
+          for (long k = j + 1; k < jend; ++k)
+            row[k] -= l * pivot_row[k];
+        }
+      }
+      return 0;
+    }
+
+    // Cholesky-Banachiewicz factorization of the n x n block at a
+    template <class T, class N>
+    long cholesky_block(T *a, N n, long lda)
+    {
+      for (long i = 0; i < n; ++i) {
+        T *row = a + i * lda;
+        for (long j = 0; j <= i; ++j) {
+          T const *other = a + j * lda;
+          T s = row[j];
+          for (long k = 0; k < j; ++k)
+            s -= row[k] * conjugate(other[k]);
+          if (i == j) {
+            auto d = real_part(s);
+            if (!(d > 0))
+              return i + 1;
+            row[i] = std::sqrt(d);
+          } else
+            row[j] = s / other[j];
+        }
+      }
+      return 0;
+    }
+  }
+
+  template <class S>
+  long square_matrices(S const &shape, long &n)
+  {
+    long N = shape.size();
+    n = shape[N - 1];
+    if (N < 2 || shape[N - 2] != n)
+      throw types::ValueError("Last 2 dimensions of the array must be square");
+    long count = 1;
+    for (long d = 0; d < N - 2; ++d)
+      count *= shape[d];
+    return count;
+  }
+
+  template <class T>
+  scratch<T>::scratch(long n)
+  {
+    if (n <= 64)
+      data_ = local_;
+    else {
+      heap_.reset(new T[n]);
+      data_ = heap_.get();
+    }
+  }
+
+  template <class T>
+  T *scratch<T>::data()
+  {
+    return data_;
+  }
+
+  template <class T, class N>
+  long lu_factor(T *a, N n, long *piv)
+  {
+    constexpr long B = PYTHRAN_LINALG_BLOCK_SIZE;
+    if (n <= B)
+      return details::lu_panel(a, n, 0, n, piv);
+
+    for (long j0 = 0; j0 < n; j0 += B) {
+      long jb = std::min(B, n - j0), r = n - j0 - jb;
+      if (long info = details::lu_panel(a, n, j0, j0 + jb, piv))
+        return info;
+      if (r == 0)
+        break;
+      T *a11 = a + j0 * n + j0, *a12 = a11 + jb, *a21 = a11 + jb * n;
+      details::trsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, jb, r,
+                    a11, n, a12, n);
+      details::gemm_sub(CblasNoTrans, r, r, jb, a21, n, a12, n, a21 + jb, n);
+    }
+    return 0;
+  }
+
+  template <class T, class N, class R>
+  void lu_solve(T const *lu, N n, long const *piv, T *b, R nrhs)
+  {
+    for (long i = 0; i < n; ++i)
+      if (piv[i] != i)
+        std::swap_ranges(b + i * nrhs, b + (i + 1) * nrhs, b + piv[i] * nrhs);
+
+    if (n > PYTHRAN_LINALG_BLOCK_SIZE) {
+      details::trsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, n, nrhs,
+                    lu, n, b, nrhs);
+      details::trsm(CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n,
+                    nrhs, lu, n, b, nrhs);
+      return;
+    }
+
+    for (long i = 0; i < n; ++i) {
+      T *row = b + i * nrhs;
+      for (long r = 0; r < i; ++r) {
+        T l = lu[i * n + r];
+        T const *other = b + r * nrhs;
+        for (long k = 0; k < nrhs; ++k)
+          row[k] -= l * other[k];
+      }
+    }
+    for (long i = n - 1; i >= 0; --i) {
+      T *row = b + i * nrhs;
+      for (long r = i + 1; r < n; ++r) {
+        T u = lu[i * n + r];
+        T const *other = b + r * nrhs;
+        for (long k = 0; k < nrhs; ++k)
+          row[k] -= u * other[k];
+      }
+      T inv = T(1) / lu[i * n + i];
+      for (long k = 0; k < nrhs; ++k)
+        row[k] *= inv;
+    }
+  }
+
+  template <class T, class N>
+  long cholesky_factor(T *a, N n)
+  {
+    constexpr long B = PYTHRAN_LINALG_BLOCK_SIZE;
+    long info = 0;
+    if (n <= B)
+      info = details::cholesky_block(a, n, n);
+    else
+      for (long j0 = 0; j0 < n; j0 += B) {
+        long jb = std::min(B, n - j0), r = n - j0 - jb;
+        T *a11 = a + j0 * n + j0, *a21 = a11 + jb * n;
+        if ((info = details::cholesky_block(a11, jb, n)))
+          return info + j0;
+        if (r == 0)
+          break;
+        details::trsm(CblasRight, CblasLower, CblasConjTrans, CblasNonUnit, r,
+                      jb, a11, n, a21, n);
+        details::herk_sub(r, jb, a21, n, a21 + jb, n);
+      }
+    if (!info)
+      for (long i = 0; i < n; ++i)
+        std::fill(a + i * n + i + 1, a + (i + 1) * n, T(0));
+    return info;
+  }
+
+  template <class T>
+  void jacobi_svd(T *w, long m, long n, T *v)
+  {
+    using R = decltype(details::real_part(T()));
+    R const eps = std::numeric_limits<R>::epsilon();
+    std::fill(v, v + n * n, T(0));
+    for (long j = 0; j < n; ++j)
+      v[j * n + j] = T(1);
+
+    // sweeps over all pairs of columns, each rotation making a pair
+    // orthogonal, until they all are
+    for (long sweep = 0; sweep < 64; ++sweep) {
+      bool rotated = false;
+      for (long p = 0; p < n; ++p)
+        for (long q = p + 1; q < n; ++q) {
+          T *wp = w + p * m, *wq = w + q * m, *vp = v + p * n, *vq = v + q * n;
+          R alpha = 0, beta = 0;
+          T gamma = T(0);
+          for (long i = 0; i < m; ++i) {
+            alpha += std::norm(wp[i]);
+            beta += std::norm(wq[i]);
+            gamma += details::conjugate(wp[i]) * wq[i];
+          }
+          R g = std::abs(gamma);
+          if (!(g > eps * std::sqrt(alpha * beta)))
+            continue;
+          rotated = true;
+
+          // rotate the phase of q so that its product with p is real
+          T phase = details::conjugate(gamma / g);
+          for (long i = 0; i < m; ++i)
+            wq[i] *= phase;
+          for (long i = 0; i < n; ++i)
+            vq[i] *= phase;
+
+          R zeta = (beta - alpha) / (2 * g);
+          R t = (zeta >= 0 ? 1 : -1) /
+                (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+          R c = 1 / std::sqrt(1 + t * t), s = c * t;
+          for (long i = 0; i < m; ++i) {
+            T x = wp[i], y = wq[i];
+            wp[i] = c * x - s * y;
+            wq[i] = s * x + c * y;
+          }
+          for (long i = 0; i < n; ++i) {
+            T x = vp[i], y = vq[i];
+            vp[i] = c * x - s * y;
+            vq[i] = s * x + c * y;
+          }
+        }
+      if (!rotated)
+        break;
+    }
+  }
+
+  template <class T>
+  matrix_structure structure_of(T const *a, long n)
+  {
+    bool upper = true, lower = true, symmetric = true;
+    for (long i = 1; i < n && (upper || lower || symmetric); ++i)
+      for (long j = 0; j < i; ++j) {
+        T below = a[i * n + j], above = a[j * n + i];
+        upper = upper && below == T(0);
+        lower = lower && above == T(0);
+        symmetric = symmetric && below == above;
+      }
+    if (upper)
+      return matrix_structure::upper;
+    if (lower)
+      return matrix_structure::lower;
+    if (symmetric)
+      return matrix_structure::symmetric;
+    return matrix_structure::general;
+  }
+
+  template <class T>
+  void symmetric_square(T const *a, long n, T *c)
+  {
+    details::syrk(n, a, c);
+    for (long i = 1; i < n; ++i)
+      for (long j = 0; j < i; ++j)
+        c[j * n + i] = c[i * n + j];
+  }
+
+  template <class T>
+  void triangular_multiply(bool left, bool upper, T const *a, long n, T *b)
+  {
+    details::trmm(left ? CblasLeft : CblasRight,
+                  upper ? CblasUpper : CblasLower, n, n, a, b);
+  }
+
+  template <class F>
+  long for_each_matrix(long count, long cost, F const &f)
+  {
+    long first = count, info = 0;
+#ifdef _OPENMP
+#pragma omp parallel for if (count > 1 &&                                      \
+                             count * cost >=                                   \
+                                 PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#else
+    (void)cost;
+#endif
+    for (long i = 0; i < count; ++i)
+      if (long status = f(i)) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        if (i < first) {
+          first = i;
+          info = status;
+        }
+      }
+    return info;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
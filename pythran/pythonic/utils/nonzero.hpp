@@ -0,0 +1,176 @@
+#ifndef PYTHONIC_UTILS_NONZERO_HPP
+#define PYTHONIC_UTILS_NONZERO_HPP
+
+#include "pythonic/include/utils/nonzero.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  template <class T>
+  bool nonzero_pred<T>::operator()(long i) const
+  {
+    return data[i] != T(0);
+  }
+
+  long nonzero_counts::total() const
+  {
+    return offsets.back();
+  }
+
+  namespace
+  {
+    template <class Pred>
+    long _count_block(Pred const &pred, long lo, long hi)
+    {
+      long c = 0;
+      for (long i = lo; i < hi; ++i)
+        c += pred(i) ? 1 : 0;
+      return c;
+    }
+
+    // booleans are stored as 0/1 bytes: count them a word at a time, the
+    // multiplication sums the bytes of the word into its most significant one
+    long _count_block(nonzero_pred<bool> const &pred, long lo, long hi)
+    {
+      long c = 0;
+      long i = lo;
+      for (; i + 8 <= hi; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, pred.data + i, sizeof(word));
+        c += (word * 0x0101010101010101ULL) >> 56;
+      }
+      for (; i < hi; ++i)
+        c += pred.data[i];
+      return c;
+    }
+
+    template <class Pred, class F>
+    void _fill_block(Pred const &pred, long lo, long hi, long pos, F &f)
+    {
+      for (long i = lo; i < hi; ++i)
+        if (pred(i))
+          f(pos++, i);
+    }
+
+    // skip over words of false without testing each byte
+    template <class F>
+    void _fill_block(nonzero_pred<bool> const &pred, long lo, long hi,
+                     long pos, F &f)
+    {
+      long i = lo;
+      for (; i + 8 <= hi; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, pred.data + i, sizeof(word));
+        if (word)
+          for (long j = i; j < i + 8; ++j)
+            if (pred.data[j])
+              f(pos++, j);
+      }
+      for (; i < hi; ++i)
+        if (pred.data[i])
+          f(pos++, i);
+    }
+  }
+
+  template <class Pred>
+  nonzero_counts count_nonzero_blocks(Pred const &pred, long n)
+  {
+    long const block = PYTHRAN_NONZERO_BLOCK_SIZE;
+    long nblocks = (n + block - 1) / block;
+    nonzero_counts counts{n, std::vector<long>(nblocks + 1)};
+    long *offsets = counts.offsets.data();
+#ifdef _OPENMP
+    if (nblocks > 1 && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+#pragma omp parallel for
+      for (long b = 0; b < nblocks; ++b)
+        offsets[b + 1] =
+            _count_block(pred, b * block, std::min(n, (b + 1) * block));
+    } else
+#endif
+      for (long b = 0; b < nblocks; ++b)
+        offsets[b + 1] =
+            _count_block(pred, b * block, std::min(n, (b + 1) * block));
+    // exclusive prefix sum
+    for (long b = 0; b < nblocks; ++b)
+      offsets[b + 1] += offsets[b];
+    return counts;
+  }
+
+  template <class T>
+  nonzero_counts count_nonzero_blocks(T *data, long n)
+  {
+    return count_nonzero_blocks(
+        nonzero_pred<typename std::remove_const<T>::type>{data}, n);
+  }
+
+  template <class Pred, class F>
+  void for_each_nonzero(Pred const &pred, nonzero_counts const &counts, F f)
+  {
+    long const block = PYTHRAN_NONZERO_BLOCK_SIZE;
+    long n = counts.size;
+    long nblocks = counts.offsets.size() - 1;
+    long const *offsets = counts.offsets.data();
+#ifdef _OPENMP
+    if (nblocks > 1 && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+#pragma omp parallel for firstprivate(f)
+      for (long b = 0; b < nblocks; ++b)
+        if (offsets[b] != offsets[b + 1])
+          _fill_block(pred, b * block, std::min(n, (b + 1) * block),
+                      offsets[b], f);
+    } else
+#endif
+      for (long b = 0; b < nblocks; ++b)
+        if (offsets[b] != offsets[b + 1])
+          _fill_block(pred, b * block, std::min(n, (b + 1) * block),
+                      offsets[b], f);
+  }
+
+  template <class T, class F>
+  void for_each_nonzero(T *data, nonzero_counts const &counts, F f)
+  {
+    for_each_nonzero(nonzero_pred<typename std::remove_const<T>::type>{data},
+                     counts, f);
+  }
+
+  namespace
+  {
+    template <class Pred>
+    long *_nonzero_indices(Pred const &pred, long sz, long &n)
+    {
+      auto counts = count_nonzero_blocks(pred, sz);
+      n = counts.total();
+      long *raw = (long *)malloc(n * sizeof(long));
+      for_each_nonzero(pred, counts, [=](long pos, long i) { raw[pos] = i; });
+      return raw;
+    }
+  }
+
+  template <class F>
+  long *nonzero_indices(F const &filter, long &n)
+  {
+    // both passes read the mask: evaluate it once
+    types::ndarray<typename F::dtype, types::pshape<long>> mask(filter);
+    return nonzero_indices(mask, n);
+  }
+
+  template <class pS>
+  long *nonzero_indices(types::ndarray<bool, pS> const &filter, long &n)
+  {
+    return _nonzero_indices(nonzero_pred<bool>{filter.buffer},
+                            filter.template shape<0>(), n);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
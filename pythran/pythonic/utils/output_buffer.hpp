@@ -0,0 +1,474 @@
+#ifndef PYTHONIC_UTILS_OUTPUT_BUFFER_HPP
+#define PYTHONIC_UTILS_OUTPUT_BUFFER_HPP
+
+#include "pythonic/include/utils/output_buffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unistd.h>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  output_buffer::output_buffer()
+  {
+    setp(data_, data_ + sizeof(data_));
+  }
+
+  int output_buffer::overflow(int c)
+  {
+    sync();
+    if (c != traits_type::eof()) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize output_buffer::xsputn(char const *s, std::streamsize n)
+  {
+    if (n > epptr() - pptr()) {
+      sync();
+      // too large to be worth a copy
+      if (n >= epptr() - pptr()) {
+        drain(s, n);
+        return n;
+      }
+    }
+    std::memcpy(pptr(), s, n);
+    pbump(n);
+    return n;
+  }
+
+  int output_buffer::sync()
+  {
+    if (pptr() != pbase())
+      drain(pbase(), pptr() - pbase());
+    setp(data_, data_ + sizeof(data_));
+    return 0;
+  }
+
+  void output_buffer::write(char const *s, std::size_t n)
+  {
+    sputn(s, n);
+  }
+
+  void output_buffer::put(char c)
+  {
+    sputc(c);
+  }
+
+  stdio_buffer::stdio_buffer(FILE *f) : f_(f), interactive_(isatty(fileno(f)))
+  {
+  }
+
+  stdio_buffer::~stdio_buffer()
+  {
+    flush();
+  }
+
+  void stdio_buffer::drain(char const *s, std::size_t n)
+  {
+    fwrite(s, sizeof(char), n, f_);
+  }
+
+  bool stdio_buffer::interactive() const
+  {
+    return interactive_;
+  }
+
+  std::mutex &stdio_buffer::mutex()
+  {
+    return mutex_;
+  }
+
+  void stdio_buffer::flush()
+  {
+    sync();
+    fflush(f_);
+  }
+
+  stdio_buffer &stdout_buffer()
+  {
+    static stdio_buffer buffer(stdout);
+    return buffer;
+  }
+
+  template <class I>
+  void write_integer(output_buffer &out, I value)
+  {
+    using magnitude_type = typename std::make_unsigned<I>::type;
+    char repr[3 * sizeof(I) + 1];
+    char *const end = repr + sizeof(repr);
+    char *iter = end;
+    bool const negative = value < I(0);
+    magnitude_type magnitude = negative ? magnitude_type(0) - value : value;
+    do {
+      *--iter = '0' + magnitude % 10;
+      magnitude /= 10;
+    } while (magnitude);
+    if (negative)
+      *--iter = '-';
+    out.write(iter, end - iter);
+  }
+
+  namespace details
+  {
+    inline double read_back(char const *repr, double)
+    {
+      return std::strtod(repr, nullptr);
+    }
+
+    inline float read_back(char const *repr, float)
+    {
+      return std::strtof(repr, nullptr);
+    }
+
+    /* Shortest digits of a positive value through Loitsch's Grisu3, with
+     * 64 bit integer arithmetic only: the value and the bounds of the
+     * interval rounding to it are scaled by a cached power of ten into a
+     * fixed point range, then digits are generated until the remainder is
+     * within the interval. Returns false in the rare cases where the result
+     * cannot be proven shortest and closest, and sets value = digits *
+     * 10^exponent otherwise.
+     */
+    struct diy_fp {
+      std::uint64_t f;
+      int e;
+    };
+
+    inline diy_fp operator*(diy_fp x, diy_fp y)
+    {
+      std::uint64_t const mask = 0xffffffffu;
+      std::uint64_t a = x.f >> 32, b = x.f & mask, c = y.f >> 32,
+                    d = y.f & mask;
+      std::uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+      std::uint64_t tmp = (bd >> 32) + (ad & mask) + (bc & mask);
+      tmp += std::uint64_t(1) << 31; // round
+      return {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64};
+    }
+
+    inline diy_fp normalize(diy_fp x)
+    {
+      while (!(x.f & (std::uint64_t(1) << 63))) {
+        x.f <<= 1;
+        --x.e;
+      }
+      return x;
+    }
+
+    // value = f * 2^e, and whether the next smaller value is closer
+    inline diy_fp decompose(double value, bool &lower_closer)
+    {
+      std::uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      std::uint64_t fraction = bits & ((std::uint64_t(1) << 52) - 1);
+      int biased = bits >> 52 & 0x7ff;
+      lower_closer = fraction == 0 && biased > 1;
+      if (biased)
+        return {fraction | std::uint64_t(1) << 52, biased - 1075};
+      return {fraction, -1074};
+    }
+
+    inline diy_fp decompose(float value, bool &lower_closer)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      std::uint32_t fraction = bits & ((std::uint32_t(1) << 23) - 1);
+      int biased = bits >> 23 & 0xff;
+      lower_closer = fraction == 0 && biased > 1;
+      if (biased)
+        return {fraction | std::uint32_t(1) << 23, biased - 150};
+      return {fraction, -149};
+    }
+
+    // Normalized 10^k for k = -348, -340, ..., 340
+    struct cached_power {
+      std::uint64_t f;
+      short e, k;
+    };
+
+    inline cached_power const &cached_power_for(int e)
+    {
+      static cached_power const powers[] = {
+          {0xfa8fd5a0081c0288ull, -1220, -348},
+          {0xbaaee17fa23ebf76ull, -1193, -340},
+          {0x8b16fb203055ac76ull, -1166, -332},
+          {0xcf42894a5dce35eaull, -1140, -324},
+          {0x9a6bb0aa55653b2dull, -1113, -316},
+          {0xe61acf033d1a45dfull, -1087, -308},
+          {0xab70fe17c79ac6caull, -1060, -300},
+          {0xff77b1fcbebcdc4full, -1034, -292},
+          {0xbe5691ef416bd60cull, -1007, -284},
+          {0x8dd01fad907ffc3cull, -980, -276},
+          {0xd3515c2831559a83ull, -954, -268},
+          {0x9d71ac8fada6c9b5ull, -927, -260},
+          {0xea9c227723ee8bcbull, -901, -252},
+          {0xaecc49914078536dull, -874, -244},
+          {0x823c12795db6ce57ull, -847, -236},
+          {0xc21094364dfb5637ull, -821, -228},
+          {0x9096ea6f3848984full, -794, -220},
+          {0xd77485cb25823ac7ull, -768, -212},
+          {0xa086cfcd97bf97f4ull, -741, -204},
+          {0xef340a98172aace5ull, -715, -196},
+          {0xb23867fb2a35b28eull, -688, -188},
+          {0x84c8d4dfd2c63f3bull, -661, -180},
+          {0xc5dd44271ad3cdbaull, -635, -172},
+          {0x936b9fcebb25c996ull, -608, -164},
+          {0xdbac6c247d62a584ull, -582, -156},
+          {0xa3ab66580d5fdaf6ull, -555, -148},
+          {0xf3e2f893dec3f126ull, -529, -140},
+          {0xb5b5ada8aaff80b8ull, -502, -132},
+          {0x87625f056c7c4a8bull, -475, -124},
+          {0xc9bcff6034c13053ull, -449, -116},
+          {0x964e858c91ba2655ull, -422, -108},
+          {0xdff9772470297ebdull, -396, -100},
+          {0xa6dfbd9fb8e5b88full, -369, -92},
+          {0xf8a95fcf88747d94ull, -343, -84},
+          {0xb94470938fa89bcfull, -316, -76},
+          {0x8a08f0f8bf0f156bull, -289, -68},
+          {0xcdb02555653131b6ull, -263, -60},
+          {0x993fe2c6d07b7facull, -236, -52},
+          {0xe45c10c42a2b3b06ull, -210, -44},
+          {0xaa242499697392d3ull, -183, -36},
+          {0xfd87b5f28300ca0eull, -157, -28},
+          {0xbce5086492111aebull, -130, -20},
+          {0x8cbccc096f5088ccull, -103, -12},
+          {0xd1b71758e219652cull, -77, -4},
+          {0x9c40000000000000ull, -50, 4},
+          {0xe8d4a51000000000ull, -24, 12},
+          {0xad78ebc5ac620000ull, 3, 20},
+          {0x813f3978f8940984ull, 30, 28},
+          {0xc097ce7bc90715b3ull, 56, 36},
+          {0x8f7e32ce7bea5c70ull, 83, 44},
+          {0xd5d238a4abe98068ull, 109, 52},
+          {0x9f4f2726179a2245ull, 136, 60},
+          {0xed63a231d4c4fb27ull, 162, 68},
+          {0xb0de65388cc8ada8ull, 189, 76},
+          {0x83c7088e1aab65dbull, 216, 84},
+          {0xc45d1df942711d9aull, 242, 92},
+          {0x924d692ca61be758ull, 269, 100},
+          {0xda01ee641a708deaull, 295, 108},
+          {0xa26da3999aef774aull, 322, 116},
+          {0xf209787bb47d6b85ull, 348, 124},
+          {0xb454e4a179dd1877ull, 375, 132},
+          {0x865b86925b9bc5c2ull, 402, 140},
+          {0xc83553c5c8965d3dull, 428, 148},
+          {0x952ab45cfa97a0b3ull, 455, 156},
+          {0xde469fbd99a05fe3ull, 481, 164},
+          {0xa59bc234db398c25ull, 508, 172},
+          {0xf6c69a72a3989f5cull, 534, 180},
+          {0xb7dcbf5354e9beceull, 561, 188},
+          {0x88fcf317f22241e2ull, 588, 196},
+          {0xcc20ce9bd35c78a5ull, 614, 204},
+          {0x98165af37b2153dfull, 641, 212},
+          {0xe2a0b5dc971f303aull, 667, 220},
+          {0xa8d9d1535ce3b396ull, 694, 228},
+          {0xfb9b7cd9a4a7443cull, 720, 236},
+          {0xbb764c4ca7a44410ull, 747, 244},
+          {0x8bab8eefb6409c1aull, 774, 252},
+          {0xd01fef10a657842cull, 800, 260},
+          {0x9b10a4e5e9913129ull, 827, 268},
+          {0xe7109bfba19c0c9dull, 853, 276},
+          {0xac2820d9623bf429ull, 880, 284},
+          {0x80444b5e7aa7cf85ull, 907, 292},
+          {0xbf21e44003acdd2dull, 933, 300},
+          {0x8e679c2f5e44ff8full, 960, 308},
+          {0xd433179d9c8cb841ull, 986, 316},
+          {0x9e19db92b4e31ba9ull, 1013, 324},
+          {0xeb96bf6ebadf77d9ull, 1039, 332},
+          {0xaf87023b9bf0ee6bull, 1066, 340},
+      };
+      // smallest k such that 10^k * 2^e has a binary exponent >= -60
+      int const k = std::ceil((-61 - e) * 0.30102999566398114);
+      return powers[(348 + k - 1) / 8 + 1];
+    }
+
+    inline bool round_weed(char *digits, int ndigits, std::uint64_t distance,
+                           std::uint64_t unsafe, std::uint64_t rest,
+                           std::uint64_t ten_kappa, std::uint64_t unit)
+    {
+      std::uint64_t small = distance - unit, big = distance + unit;
+      // move the last digit towards the value while it gets closer
+      while (rest < small && unsafe - rest >= ten_kappa &&
+             (rest + ten_kappa < small ||
+              small - rest >= rest + ten_kappa - small)) {
+        --digits[ndigits - 1];
+        rest += ten_kappa;
+      }
+      // another candidate may be as close, given the imprecision
+      if (rest < big && unsafe - rest >= ten_kappa &&
+          (rest + ten_kappa < big || big - rest > rest + ten_kappa - big))
+        return false;
+      return 2 * unit <= rest && rest <= unsafe - 4 * unit;
+    }
+
+    template <class T>
+    bool grisu3(T value, char *digits, int &ndigits, int &exponent)
+    {
+      bool lower_closer;
+      diy_fp v = decompose(value, lower_closer);
+      diy_fp plus = normalize({(v.f << 1) + 1, v.e - 1});
+      diy_fp minus = lower_closer ? diy_fp{(v.f << 2) - 1, v.e - 2}
+                                  : diy_fp{(v.f << 1) - 1, v.e - 1};
+      minus = {minus.f << (minus.e - plus.e), plus.e};
+      diy_fp w = normalize(v);
+
+      cached_power const &power = cached_power_for(w.e);
+      diy_fp const scale = {power.f, power.e};
+      w = w * scale;
+      minus = minus * scale;
+      plus = plus * scale;
+
+      // the value lies within (too_low, too_high), given the imprecision
+      std::uint64_t unit = 1;
+      std::uint64_t const too_high = plus.f + unit;
+      std::uint64_t unsafe = too_high - (minus.f - unit);
+      int const shift = -w.e;
+      std::uint64_t const one = std::uint64_t(1) << shift;
+      std::uint32_t integrals = too_high >> shift;
+      std::uint64_t fractionals = too_high & (one - 1);
+
+      std::uint32_t divisor = 1;
+      int kappa = integrals ? 1 : 0;
+      while (kappa < 10 && integrals / divisor >= 10) {
+        divisor *= 10;
+        ++kappa;
+      }
+
+      ndigits = 0;
+      for (; kappa > 0; divisor /= 10) {
+        digits[ndigits++] = '0' + integrals / divisor;
+        integrals %= divisor;
+        --kappa;
+        std::uint64_t rest = (std::uint64_t(integrals) << shift) + fractionals;
+        if (rest < unsafe) {
+          exponent = kappa - power.k;
+          return round_weed(digits, ndigits, too_high - w.f, unsafe, rest,
+                            std::uint64_t(divisor) << shift, unit);
+        }
+      }
+      while (true) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe *= 10;
+        digits[ndigits++] = '0' + (fractionals >> shift);
+        fractionals &= one - 1;
+        --kappa;
+        if (fractionals < unsafe) {
+          exponent = kappa - power.k;
+          return round_weed(digits, ndigits, (too_high - w.f) * unit, unsafe,
+                            fractionals, one, unit);
+        }
+      }
+    }
+
+    /* Exact search, from the rounding of value to digits10 digits, which
+     * reads back unchanged if any decimal number of digits10 digits does, to
+     * max_digits10 digits which always read back. Subnormal numbers have
+     * fewer significant digits, so that their search starts from one digit.
+     */
+    template <class T>
+    void shortest_digits(T value, char *digits, int &ndigits, int &exponent)
+    {
+      char repr[32];
+      int precision = std::fpclassify(value) == FP_SUBNORMAL
+                          ? 1
+                          : std::numeric_limits<T>::digits10;
+      for (;; ++precision) {
+        std::snprintf(repr, sizeof(repr), "%.*e", precision - 1,
+                      static_cast<double>(value));
+        if (precision == std::numeric_limits<T>::max_digits10 ||
+            read_back(repr, value) == value)
+          break;
+      }
+      // repr is d.ddde[+-]xx
+      char const *iter = repr;
+      ndigits = 0;
+      for (; *iter != 'e'; ++iter)
+        if (*iter != '.')
+          digits[ndigits++] = *iter;
+      exponent = std::atoi(iter + 1) - (ndigits - 1);
+    }
+
+    template <class T>
+    void write_float(output_buffer &out, T value)
+    {
+      if (std::isnan(value))
+        return out.write("nan", 3);
+      if (std::isinf(value))
+        return value < 0 ? out.write("-inf", 4) : out.write("inf", 3);
+
+      // value = digits * 10^exponent
+      char digits[24];
+      int ndigits = 1, exponent = 0;
+      bool const negative = std::signbit(value);
+      if (negative)
+        value = -value;
+      if (value == 0)
+        digits[0] = '0';
+      else if (!grisu3(value, digits, ndigits, exponent))
+        shortest_digits(value, digits, ndigits, exponent);
+      while (ndigits > 1 && digits[ndigits - 1] == '0') {
+        --ndigits;
+        ++exponent;
+      }
+      // exponent of the first digit
+      exponent += ndigits - 1;
+
+      char layout[48];
+      char *oiter = layout;
+      if (negative)
+        *oiter++ = '-';
+      if (exponent < -4 || exponent >= 16) {
+        *oiter++ = digits[0];
+        if (ndigits > 1) {
+          *oiter++ = '.';
+          oiter = std::copy(digits + 1, digits + ndigits, oiter);
+        }
+        *oiter++ = 'e';
+        *oiter++ = exponent < 0 ? '-' : '+';
+        int const magnitude = std::abs(exponent);
+        if (magnitude >= 100)
+          *oiter++ = '0' + magnitude / 100;
+        *oiter++ = '0' + magnitude / 10 % 10;
+        *oiter++ = '0' + magnitude % 10;
+      } else if (exponent >= 0) {
+        for (int i = 0; i <= exponent; ++i)
+          *oiter++ = i < ndigits ? digits[i] : '0';
+        *oiter++ = '.';
+        if (ndigits > exponent + 1)
+          oiter = std::copy(digits + exponent + 1, digits + ndigits, oiter);
+        else
+          *oiter++ = '0';
+      } else {
+        *oiter++ = '0';
+        *oiter++ = '.';
+        for (int i = -1; i > exponent; --i)
+          *oiter++ = '0';
+        oiter = std::copy(digits, digits + ndigits, oiter);
+      }
+      out.write(layout, oiter - layout);
+    }
+  }
+
+  void write_float(output_buffer &out, double value)
+  {
+    details::write_float(out, value);
+  }
+
+  void write_float(output_buffer &out, float value)
+  {
+    details::write_float(out, value);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
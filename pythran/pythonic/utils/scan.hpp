@@ -0,0 +1,159 @@
+#ifndef PYTHONIC_UTILS_SCAN_HPP
+#define PYTHONIC_UTILS_SCAN_HPP
+
+#include "pythonic/include/utils/scan.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+#define PYTHRAN_ASSOCIATIVE_OP(trait, ns, name)                                \
+  template <>                                                                  \
+  struct trait<ns::functor::name> : std::true_type {                           \
+  };
+
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, add)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, iadd)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, mul)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, imul)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, and_)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, iand)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, or_)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, ior)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, xor_)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, operator_, ixor)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, add)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, multiply)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, bitwise_and)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, bitwise_or)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, bitwise_xor)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, logical_and)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_op, numpy, logical_or)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_int_op, numpy, maximum)
+  PYTHRAN_ASSOCIATIVE_OP(is_associative_int_op, numpy, minimum)
+
+#undef PYTHRAN_ASSOCIATIVE_OP
+
+  namespace details
+  {
+    // Operators may update their first operand in place, hence the copies.
+    template <class Op, class T, class A>
+    A scan_from(T const *in, A *out, long n, A acc)
+    {
+      for (long i = 0; i < n; ++i) {
+        acc = Op{}(acc, static_cast<A>(in[i]));
+        out[i] = acc;
+      }
+      return acc;
+    }
+
+    template <class Op, class T, class A>
+    A reduce_from(T const *in, long n, A acc)
+    {
+      for (long i = 0; i < n; ++i)
+        acc = Op{}(acc, static_cast<A>(in[i]));
+      return acc;
+    }
+
+#ifdef _OPENMP
+    template <class Op, class T, class A>
+    void parallel_scan(T const *in, A *out, long n)
+    {
+      constexpr long B = PYTHRAN_SCAN_BLOCK_SIZE;
+      long nblocks = (n + B - 1) / B;
+      std::vector<A> totals(nblocks);
+#pragma omp parallel for
+      for (long b = 0; b < nblocks; ++b) {
+        long beg = b * B, end = std::min(n, beg + B);
+        totals[b] = reduce_from<Op>(in + beg + 1, end - beg - 1,
+                                    static_cast<A>(in[beg]));
+      }
+      for (long b = 1; b < nblocks; ++b) {
+        A prev = totals[b - 1];
+        totals[b] = Op{}(prev, totals[b]);
+      }
+#pragma omp parallel for
+      for (long b = 0; b < nblocks; ++b) {
+        long beg = b * B, end = std::min(n, beg + B);
+        if (b == 0) {
+          out[0] = static_cast<A>(in[0]);
+          scan_from<Op>(in + 1, out + 1, end - 1, out[0]);
+        } else
+          scan_from<Op>(in + beg, out + beg, end - beg, totals[b - 1]);
+      }
+    }
+#endif
+  }
+
+  template <class Op, class T, class A>
+  void inclusive_scan(T const *in, A *out, long n)
+  {
+    if (n == 0)
+      return;
+#ifdef _OPENMP
+    if (is_associative<Op, A>::value && n > PYTHRAN_SCAN_BLOCK_SIZE &&
+        omp_get_max_threads() > 1)
+      return details::parallel_scan<Op>(in, out, n);
+#endif
+    out[0] = static_cast<A>(in[0]);
+    details::scan_from<Op>(in + 1, out + 1, n - 1, out[0]);
+  }
+
+  template <class Op, class T, class A>
+  void inclusive_scan_axis(T const *in, A *out, long outer, long length,
+                           long inner)
+  {
+    if (outer == 0 || length == 0 || inner == 0)
+      return;
+    if (inner == 1) {
+      if (outer == 1)
+        return inclusive_scan<Op>(in, out, length);
+#ifdef _OPENMP
+#pragma omp parallel for if (outer * length >=                                 \
+                             PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+      for (long o = 0; o < outer; ++o) {
+        out[o * length] = static_cast<A>(in[o * length]);
+        details::scan_from<Op>(in + o * length + 1, out + o * length + 1,
+                               length - 1, out[o * length]);
+      }
+      return;
+    }
+
+    // tasks cover a few cache lines of the inner axis, so that the previous
+    // slice is still in cache when the next one is computed
+    constexpr long chunk = 1024;
+    long nchunks = (inner + chunk - 1) / chunk;
+#ifdef _OPENMP
+#pragma omp parallel for if (outer * length * inner >=                         \
+                             PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long t = 0; t < outer * nchunks; ++t) {
+      long o = t / nchunks;
+      long j0 = (t % nchunks) * chunk, j1 = std::min(inner, j0 + chunk);
+      T const *src = in + o * length * inner;
+      A *dst = out + o * length * inner;
+      for (long j = j0; j < j1; ++j)
+        dst[j] = static_cast<A>(src[j]);
+      for (long i = 1; i < length; ++i) {
+        A const *prev = dst + (i - 1) * inner;
+        A *cur = dst + i * inner;
+        T const *x = src + i * inner;
+        for (long j = j0; j < j1; ++j) {
+          A acc = prev[j];
+          cur[j] = Op{}(acc, static_cast<A>(x[j]));
+        }
+      }
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,248 @@
+#ifndef PYTHONIC_UTILS_SEARCHSORTED_HPP
+#define PYTHONIC_UTILS_SEARCHSORTED_HPP
+
+#include "pythonic/include/utils/searchsorted.hpp"
+#include "pythonic/types/vectorizable_type.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  template <class T, class V>
+  bool search_left::operator()(T const &elt, V const &key) const
+  {
+    return elt < key;
+  }
+
+  template <class V>
+  bool search_left::ordered(V const &prev, V const &next) const
+  {
+    return prev <= next;
+  }
+
+  template <class T, class V>
+  bool search_right::operator()(T const &elt, V const &key) const
+  {
+    return !(key < elt);
+  }
+
+  template <class V>
+  bool search_right::ordered(V const &prev, V const &next) const
+  {
+    return prev <= next;
+  }
+
+  template <class T, class V>
+  bool search_left_decreasing::operator()(T const &elt, V const &key) const
+  {
+    return elt > key;
+  }
+
+  template <class V>
+  bool search_left_decreasing::ordered(V const &prev, V const &next) const
+  {
+    return prev >= next;
+  }
+
+  namespace
+  {
+    template <class Before, class T, class V>
+    long _linear_search(Before const &before, T const *data, long size,
+                        V const &key)
+    {
+      long count = 0;
+      for (long i = 0; i < size; ++i)
+        count += before(data[i], key) ? 1 : 0;
+      return count;
+    }
+
+#ifdef USE_XSIMD
+    template <class T>
+    long _vcount_less(T const *data, long size, T const &key, bool flip)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      vT vkey(key), vone(T(1)), vzero(T(0)), vcount(T(0));
+      long i = 0;
+      for (; i + vN <= size; i += vN) {
+        vT velt = xsimd::load_unaligned(data + i);
+        vcount += xsimd::select(flip ? vkey < velt : velt < vkey, vone, vzero);
+      }
+      long count = xsimd::hadd(vcount);
+      for (; i < size; ++i)
+        count += (flip ? key < data[i] : data[i] < key) ? 1 : 0;
+      return count;
+    }
+
+    template <class T>
+    typename std::enable_if<types::is_vectorizable<T>::value &&
+                                std::is_arithmetic<T>::value &&
+                                !std::is_same<T, bool>::value,
+                            long>::type
+    _linear_search(search_left const &, T const *data, long size,
+                   T const &key)
+    {
+      return _vcount_less(data, size, key, false);
+    }
+
+    template <class T>
+    typename std::enable_if<types::is_vectorizable<T>::value &&
+                                std::is_arithmetic<T>::value &&
+                                !std::is_same<T, bool>::value,
+                            long>::type
+    _linear_search(search_right const &, T const *data, long size,
+                   T const &key)
+    {
+      return size - _vcount_less(data, size, key, true);
+    }
+#endif
+
+    // bisection without data-dependent branches
+    template <class Before, class T, class V>
+    long _binary_search(Before const &before, T const *data, long size,
+                        V const &key)
+    {
+      if (size == 0)
+        return 0;
+      T const *base = data;
+      while (size > 1) {
+        long half = size / 2;
+        base = before(base[half], key) ? base + half : base;
+        size -= half;
+      }
+      return (base - data) + (before(*base, key) ? 1 : 0);
+    }
+  }
+
+  template <class Before, class T>
+  long sorted_searcher<Before, T>::_build(long k, long i)
+  {
+    if (k <= size) {
+      i = _build(2 * k, i);
+      tree[k] = data[i];
+      rank[k] = i++;
+      i = _build(2 * k + 1, i);
+    }
+    return i;
+  }
+
+  template <class Before, class T>
+  sorted_searcher<Before, T>::sorted_searcher(Before before, T const *data,
+                                              long size, long nkeys)
+      : before(before), data(data), size(size)
+  {
+    if (size >= PYTHRAN_SEARCHSORTED_EYTZINGER_SIZE && nkeys >= size) {
+      tree.resize(size + 1);
+      rank.resize(size + 1);
+      _build(1, 0);
+    }
+  }
+
+  template <class Before, class T>
+  template <class V>
+  long sorted_searcher<Before, T>::_search(V const &key) const
+  {
+    if (size <= PYTHRAN_SEARCHSORTED_LINEAR_SIZE)
+      return _linear_search(before, data, size, key);
+    if (tree.empty())
+      return _binary_search(before, data, size, key);
+
+    T const *nodes = tree.data();
+    long k = 1;
+    while (k <= size) {
+#if defined(__GNUC__)
+      // the four levels below fit in a cache line of doubles
+      __builtin_prefetch(nodes + 16 * k);
+#endif
+      k = 2 * k + (before(nodes[k], key) ? 1 : 0);
+    }
+    // strip the right turns taken after the last left turn
+    while (k & 1)
+      k >>= 1;
+    k >>= 1;
+    return k ? rank[k] : size;
+  }
+
+  // first non-preceding element after `from', knowing data[from] precedes key
+  template <class Before, class T>
+  template <class V>
+  long sorted_searcher<Before, T>::_gallop(long from, V const &key) const
+  {
+    long step = 1;
+    while (from + step < size && before(data[from + step], key)) {
+      from += step;
+      step *= 2;
+    }
+    long last = std::min(from + step, size);
+    return from + 1 +
+           _binary_search(before, data + from + 1, last - from - 1, key);
+  }
+
+  template <class Before, class T>
+  template <class V>
+  long sorted_searcher<Before, T>::operator()(V const &key) const
+  {
+    return _search(key);
+  }
+
+  template <class Before, class T>
+  template <class V>
+  void sorted_searcher<Before, T>::operator()(V const *keys, long nkeys,
+                                              long *out) const
+  {
+    bool ordered = size > PYTHRAN_SEARCHSORTED_LINEAR_SIZE && nkeys > 1;
+    for (long i = 1; ordered && i < nkeys; ++i)
+      ordered = before.ordered(keys[i - 1], keys[i]);
+
+    if (ordered) {
+      // merge-like scan: each search starts where the previous one ended
+      long pos = _search(keys[0]);
+      out[0] = pos;
+      for (long i = 1; i < nkeys; ++i) {
+        if (pos < size && before(data[pos], keys[i]))
+          pos = _gallop(pos, keys[i]);
+        out[i] = pos;
+      }
+    } else {
+      for (long i = 0; i < nkeys; ++i)
+        out[i] = _search(keys[i]);
+    }
+  }
+
+  template <class Before, class T, class V>
+  long search_sorted(Before before, T const *data, long size, V const &key)
+  {
+    return sorted_searcher<Before, T>(before, data, size, 1)(key);
+  }
+
+  template <class Before, class T, class V>
+  void search_sorted(Before before, T const *data, long size, V const *keys,
+                     long nkeys, long *out)
+  {
+    sorted_searcher<Before, T> searcher(before, data, size, nkeys);
+    long const chunk = PYTHRAN_SEARCHSORTED_CHUNK_SIZE;
+    long nchunks = (nkeys + chunk - 1) / chunk;
+#ifdef _OPENMP
+    if (nchunks > 1 && nkeys >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+#pragma omp parallel for
+      for (long c = 0; c < nchunks; ++c)
+        searcher(keys + c * chunk, std::min(chunk, nkeys - c * chunk),
+                 out + c * chunk);
+    } else
+#endif
+      for (long c = 0; c < nchunks; ++c)
+        searcher(keys + c * chunk, std::min(chunk, nkeys - c * chunk),
+                 out + c * chunk);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef PYTHONIC_UTILS_SELECT_HPP
+#define PYTHONIC_UTILS_SELECT_HPP
+
+#include "pythonic/include/utils/select.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  template <class T>
+  bool select_less::operator()(T const &a, T const &b) const
+  {
+    return a < b;
+  }
+
+  template <class T>
+  bool select_less::operator()(std::complex<T> const &a,
+                               std::complex<T> const &b) const
+  {
+    if (std::real(a) == std::real(b))
+      return std::imag(a) < std::imag(b);
+    else
+      return std::real(a) < std::real(b);
+  }
+
+  template <class T>
+  T const &identity_key::operator()(T const &value) const
+  {
+    return value;
+  }
+
+  namespace details
+  {
+    template <class Key>
+    struct key_less {
+      Key key;
+      template <class V>
+      bool operator()(V const &a, V const &b) const
+      {
+        return select_less{}(key(a), key(b));
+      }
+    };
+
+    template <class Key>
+    struct key_is_number {
+      Key key;
+      template <class V>
+      bool operator()(V const &a) const
+      {
+        auto const &value = key(a);
+        return value == value;
+      }
+    };
+
+    template <class It, class K, class Less>
+    void multiselect(It first, It last, long offset, K kfirst, K klast,
+                     Less less)
+    {
+      // recurse on the left side and loop on the right one
+      while (kfirst != klast) {
+        K kmid = kfirst + (klast - kfirst) / 2;
+        It nth = first + (*kmid - offset);
+        std::nth_element(first, nth, last, less);
+        multiselect(first, nth, offset, kfirst, kmid, less);
+        offset += nth + 1 - first;
+        first = nth + 1;
+        kfirst = kmid + 1;
+      }
+    }
+
+    template <class D>
+    D lerp(D a, D b, double t)
+    {
+      // same rounding as numpy
+      D diff = b - a;
+      return t < 0.5 ? a + diff * t : b - diff * (1 - t);
+    }
+
+    inline long quantile_index(double q, long n)
+    {
+      return std::min(n - 1, (long)(q * (n - 1)));
+    }
+
+    template <class T, class D>
+    void quantile_select(T *data, long n, T *first, T *last, double const *qs,
+                         long const *ofirst, long const *olast, D *out,
+                         long stride)
+    {
+      while (ofirst != olast) {
+        long const *omid = ofirst + (olast - ofirst) / 2;
+        long k = quantile_index(qs[*omid], n);
+        // all the quantiles that lie between k and k + 1
+        long const *lo = std::partition_point(ofirst, omid, [&](long o) {
+          return quantile_index(qs[o], n) < k;
+        });
+        long const *hi = std::partition_point(omid, olast, [&](long o) {
+          return quantile_index(qs[o], n) == k;
+        });
+
+        T *nth = data + k;
+        std::nth_element(first, nth, last, select_less{});
+        D below = *nth, above = below;
+        bool has_above = false;
+        for (long const *o = lo; o != hi; ++o) {
+          double t = qs[*o] * (n - 1) - k;
+          if (t > 0 && !has_above) {
+            // the next element in sorted order is either the smallest of
+            // the right side, or the pivot of a previous selection
+            above = nth + 1 < last
+                        ? *std::min_element(nth + 1, last, select_less{})
+                        : nth[1];
+            has_above = true;
+          }
+          out[*o * stride] = t > 0 ? lerp(below, above, t) : below;
+        }
+
+        quantile_select(data, n, first, nth, qs, ofirst, lo, out, stride);
+        first = nth + 1;
+        ofirst = hi;
+      }
+    }
+  }
+
+  template <class It, class K, class Key>
+  void select(It first, It last, K kfirst, K klast, Key key)
+  {
+    It valid = std::partition(first, last, details::key_is_number<Key>{key});
+    klast = std::lower_bound(kfirst, klast, valid - first);
+    details::multiselect(first, valid, 0, kfirst, klast,
+                         details::key_less<Key>{key});
+  }
+
+  template <class T, class D>
+  void quantiles(T *first, long n, double const *qs, long const *order,
+                 long nq, bool skipnan, D *out, long stride)
+  {
+    T *last = first + n;
+    details::key_is_number<identity_key> is_number{};
+    if (skipnan)
+      last = std::partition(first, last, is_number);
+    else if (!std::all_of(first, last, is_number))
+      last = first;
+    if (first == last) {
+      for (long i = 0; i < nq; ++i)
+        out[order[i] * stride] = std::numeric_limits<D>::quiet_NaN();
+      return;
+    }
+    details::quantile_select(first, last - first, first, last, qs, order,
+                             order + nq, out, stride);
+  }
+
+  template <class S>
+  void split_lanes(S const &shape, long axis, long &outer, long &n,
+                   long &inner)
+  {
+    outer = 1;
+    inner = 1;
+    for (long d = 0; d < axis; ++d)
+      outer *= shape[d];
+    for (long d = axis + 1; d < (long)shape.size(); ++d)
+      inner *= shape[d];
+    n = shape[axis];
+  }
+
+  template <class B, class F>
+  void for_each_lane(long outer, long n, long inner, F const &f)
+  {
+    long nlanes = outer * inner;
+#ifdef _OPENMP
+#pragma omp parallel if (nlanes > 1 &&                                         \
+                         nlanes * n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    {
+      std::unique_ptr<B[]> buffer{new B[n]};
+#ifdef _OPENMP
+#pragma omp for
+#endif
+      for (long lane = 0; lane < nlanes; ++lane)
+        f(lane, lane / inner * n * inner + lane % inner, buffer.get());
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
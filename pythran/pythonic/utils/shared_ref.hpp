@@ -123,6 +123,18 @@ namespace utils
     return mem->foreign;
   }
 
+  template <class T>
+  bool shared_ref<T>::is_foreign() const
+  {
+    return mem && mem->foreign;
+  }
+
+  template <class T>
+  bool shared_ref<T>::unique() const noexcept
+  {
+    return mem && mem->count == 1 && !mem->foreign;
+  }
+
   template <class T>
   void shared_ref<T>::dispose()
   {
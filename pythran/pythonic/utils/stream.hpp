@@ -0,0 +1,84 @@
+#ifndef PYTHONIC_UTILS_STREAM_HPP
+#define PYTHONIC_UTILS_STREAM_HPP
+
+#include "pythonic/include/utils/stream.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/vectorizable_type.hpp"
+#include "pythonic/utils/int_.hpp"
+
+#include <algorithm>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    template <class T, class F>
+    block_stream<T, F>::block_stream(F &f)
+        : size_(0), f_(f)
+    {
+    }
+
+    template <class T, class F>
+    template <class E>
+    void block_stream<T, F>::feed(E const &expr, utils::int_<1>)
+    {
+      constexpr long B = PYTHRAN_STREAM_BLOCK_SIZE;
+      if (utils::no_broadcast_ex(expr)) {
+        // plain loops over as many elements as the block can take
+        for (long i = 0, n = expr.template shape<0>(); i < n;) {
+          long m = std::min(n - i, B - size_);
+          for (long j = 0; j < m; ++j)
+            block_[size_ + j] = expr.fast(i + j);
+          size_ += m;
+          i += m;
+          if (size_ == B)
+            flush();
+        }
+      } else {
+        // broadcast dimensions are handled by the iterators
+        for (auto &&value : expr) {
+          block_[size_++] = value;
+          if (size_ == B)
+            flush();
+        }
+      }
+    }
+
+    template <class T, class F>
+    template <class E, size_t N>
+    void block_stream<T, F>::feed(E const &expr, utils::int_<N>)
+    {
+      for (auto &&row : expr)
+        feed(row, utils::int_<N - 1>());
+    }
+
+    template <class T, class F>
+    void block_stream<T, F>::flush()
+    {
+      if (size_)
+        f_(static_cast<T const *>(block_), size_);
+      size_ = 0;
+    }
+  }
+
+  template <class E, class F>
+  void stream_blocks(E const &expr, F &&f)
+  {
+    details::block_stream<typename E::dtype, F> stream(f);
+    stream.feed(expr, utils::int_<E::value>());
+    stream.flush();
+  }
+
+  template <class T, class pS, class F>
+  void stream_blocks(types::ndarray<T, pS> const &expr, F &&f)
+  {
+    if (long n = expr.flat_size())
+      f(static_cast<T const *>(expr.buffer), n);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -10,7 +10,7 @@
 #include "pythonic/types/generator.hpp"
 
 PYTHONIC_NS_BEGIN
-yielder::yielder() : __generator_state(0)
+yielder::yielder() : __generator_state(0), __generator_pending(false)
 {
 }
 
@@ -15,7 +15,7 @@ from pythran.intrinsic import ClassWithReadOnceConstructor
 from pythran.intrinsic import ConstFunctionIntr, FunctionIntr, UpdateEffect
 from pythran.intrinsic import ConstMethodIntr, MethodIntr, AttributeIntr
 from pythran.intrinsic import ReadEffect, ConstantIntr, UFunc
-from pythran.intrinsic import ReadOnceMethodIntr
+from pythran.intrinsic import ReadOnceMethodIntr, UnboundValue
 from pythran.intrinsic import ReadOnceFunctionIntr, ConstExceptionIntr
 from pythran import interval
 from functools import reduce
@@ -2727,7 +2727,11 @@ MODULES = {
             ],
             global_effects=True
         ),
-        "print": ConstFunctionIntr(global_effects=True),
+        "print": ConstFunctionIntr(
+            kwonlyargs=('sep', 'end', 'file', 'flush'),
+            kwonlydefaults=(None, None, None, False),
+            global_effects=True
+        ),
         "pow": ConstFunctionIntr(
             signature=Union[
                 Fun[[int, int], int],
@@ -3145,6 +3149,8 @@ MODULES = {
             signature=_numpy_unary_op_int_axis_signature,
             return_range=interval.positive_values
         ),
+        "argpartition": ConstFunctionIntr(args=("a", "kth", "axis"),
+                                          defaults=(-1,)),
         "argsort": ConstMethodIntr(
             signature=_numpy_unary_op_int_axis_signature,
             return_range=interval.positive_values
@@ -3660,11 +3666,16 @@ MODULES = {
         "diff": ConstFunctionIntr(),
         "digitize": ConstFunctionIntr(),
         "divide": UFunc(BINARY_UFUNC),
-        "dot": ConstMethodIntr(),
+        "dot": MethodIntr(
+            args=('a', 'b', 'out'),
+            argument_effects=[ReadEffect(), ReadEffect(), UpdateEffect()],
+            return_alias=lambda args: ({args[2]} if len(args) == 3
+                                       else {UnboundValue})),
         "double": ConstFunctionIntr(signature=_float_signature),
         "dtype": ClassWithConstConstructor(CLASSES["dtype"]),
         "e": ConstantIntr(),
         "ediff1d": ConstFunctionIntr(),
+        "einsum": ConstFunctionIntr(),
         "empty": ConstFunctionIntr(args=('shape', 'dtype'),
                                    defaults=("numpy.float64",),
                                    signature=_numpy_ones_signature,
@@ -3722,6 +3733,15 @@ MODULES = {
             signature=_numpy_binary_op_bool_signature,
         ),
         "heaviside": UFunc(BINARY_UFUNC),
+        "histogram": ConstFunctionIntr(
+            args=('a', 'bins', 'range', 'density', 'weights'),
+            defaults=(10, None, None, None)),
+        "histogram2d": ConstFunctionIntr(
+            args=('x', 'y', 'bins', 'range', 'density', 'weights'),
+            defaults=(10, None, None, None)),
+        "histogramdd": ConstFunctionIntr(
+            args=('sample', 'bins', 'range', 'density', 'weights'),
+            defaults=(10, None, None, None)),
         "hstack": ConstFunctionIntr(),
         "hypot": UFunc(BINARY_UFUNC),
         "identity": ConstFunctionIntr(),
@@ -3766,9 +3786,15 @@ MODULES = {
         ),
         "lexsort": ConstFunctionIntr(),
         "linalg": {
+            "cholesky": ConstFunctionIntr(),
+            "det": ConstFunctionIntr(),
+            "inv": ConstFunctionIntr(),
+            "lstsq": ConstFunctionIntr(args=('a', 'b', 'rcond'),
+                                       defaults=(None,)),
             "norm": FunctionIntr(args=('x', 'ord', 'axis'),
                                  defaults=(None, None)),
             "matrix_power": ConstFunctionIntr(),
+            "solve": ConstFunctionIntr(),
         },
         "linspace": ConstFunctionIntr(),
         "log": ConstFunctionIntr(),
@@ -3792,6 +3818,7 @@ MODULES = {
             signature=_numpy_int_binary_op_signature
         ),
         "longlong": ConstFunctionIntr(signature=_int_signature),
+        "matmul": ConstFunctionIntr(),
         "max": ConstMethodIntr(signature=_numpy_unary_op_axis_signature),
         "maximum": UFunc(
             REDUCED_BINARY_UFUNC,
@@ -3817,6 +3844,10 @@ MODULES = {
         "nanargmin": ConstFunctionIntr(),
         "nanmax": ConstFunctionIntr(),
         "nanmin": ConstFunctionIntr(),
+        "nanpercentile": ConstFunctionIntr(args=("a", "q", "axis"),
+                                           defaults=(None,)),
+        "nanquantile": ConstFunctionIntr(args=("a", "q", "axis"),
+                                         defaults=(None,)),
         "nansum": ConstFunctionIntr(),
         "ndenumerate": ConstFunctionIntr(),
         "ndarray": ClassWithConstConstructor(CLASSES["ndarray"]),
@@ -3831,6 +3862,10 @@ MODULES = {
         "ones": ConstFunctionIntr(signature=_numpy_ones_signature),
         "ones_like": ConstFunctionIntr(signature=_numpy_ones_like_signature),
         "outer": ConstFunctionIntr(),
+        "partition": ConstFunctionIntr(args=("a", "kth", "axis"),
+                                       defaults=(-1,)),
+        "percentile": ConstFunctionIntr(args=("a", "q", "axis"),
+                                        defaults=(None,)),
         "pi": ConstantIntr(),
         "place": FunctionIntr(),
         "power": UFunc(
@@ -3842,6 +3877,8 @@ MODULES = {
         "ptp": ConstMethodIntr(),
         "put": MethodIntr(),
         "putmask": FunctionIntr(),
+        "quantile": ConstFunctionIntr(args=("a", "q", "axis"),
+                                      defaults=(None,)),
         "rad2deg": ConstFunctionIntr(
             signature=_numpy_float_unary_op_float_signature
         ),
@@ -3986,6 +4023,7 @@ MODULES = {
         "take": ConstMethodIntr(),
         "tan": ConstFunctionIntr(signature=_numpy_unary_op_float_signature),
         "tanh": ConstFunctionIntr(signature=_numpy_unary_op_float_signature),
+        "tensordot": ConstFunctionIntr(args=('a', 'b', 'axes'), defaults=(2,)),
         "tile": ConstFunctionIntr(),
         "trace": ConstMethodIntr(),
         "transpose": ConstMethodIntr(),
@@ -0,0 +1,12 @@
+#pythran export multi_export_dispatch(int, int)
+#pythran export multi_export_dispatch(float, int)
+#pythran export multi_export_dispatch(float[], int)
+#pythran export multi_export_dispatch(float[:,:], int)
+#pythran export multi_export_dispatch(float[:,:] order(F), int)
+#pythran export multi_export_dispatch(int[::], int)
+#runas multi_export_dispatch(1, 2); multi_export_dispatch(x=1.5, y=3); multi_export_dispatch(1, y=2)
+#runas import numpy as np; x = np.arange(10.); [multi_export_dispatch(x, 1) for _ in range(3)]; multi_export_dispatch(y=2, x=x)
+#runas import numpy as np; x = np.arange(12.).reshape(3, 4); multi_export_dispatch(x, 1); multi_export_dispatch(x.T, 2); multi_export_dispatch(x, 3)
+#runas import numpy as np; x = np.arange(12); multi_export_dispatch(x[::2], 2); multi_export_dispatch(x[::3], 2)
+def multi_export_dispatch(x, y):
+    return x * y
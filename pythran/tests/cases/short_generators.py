@@ -0,0 +1,26 @@
+#pythran export short_generators(int)
+#runas short_generators(100)
+#bench short_generators(300000)
+
+def row(i, n):
+    for j in range(n):
+        yield i * j
+
+def pairs(it):
+    while True:
+        try:
+            a = next(it)
+        except StopIteration:
+            return
+        try:
+            b = next(it)
+        except StopIteration:
+            return
+        yield a, b
+
+def short_generators(n):
+    total = 0
+    for i in range(n):
+        for a, b in pairs(row(i, 5)):
+            total += a * b
+    return total
@@ -2,6 +2,7 @@ import numpy
 import pytest
 import sys
 import unittest
+from tempfile import mkstemp
 
 from pythran.tests import TestEnv
 from pythran.typing import *
@@ -179,6 +180,12 @@ def fibo2(n): return fibo2(n-1) + fibo2(n-2) if n > 1 else n
     def test_print_tuple(self):
         self.run_test("def print_tuple(a,b,c,d): t = (a,b,c,d,'e',1.5,); print(t)", [1.,2.,3.1],3,True, "d", print_tuple=[List[float], int, bool, str])
 
+    def test_print_keywords(self):
+        self.run_test("def print_keywords(a,b): print(a, b, sep='-', end='!\\n', flush=True); print(b, end='')", 3, 0.1, print_keywords=[int, float])
+
+    def test_print_file(self):
+        self.run_test("def print_file(a, b, c):\n f = open(c, 'w')\n print(a, b, file=f, sep=',')\n f.close()\n return open(c).read()", 3, 0.1, mkstemp()[1], print_file=[int, float, str])
+
     def test_fstring(self):
         self.run_test("def fstring(a,b,c): return f'a: {a: 4d}; b: {b:.2f}; c: {c:s}'", 2, 6.28, "c", fstring=[int, float, str])
 
@@ -582,6 +589,19 @@ def yielder():
     return [i*i for i in f]"""
         self.run_test(code, yielder=[])
 
+    def test_yielder_next(self):
+        code="""
+def iyielder(i):
+    for k in range(i+3):
+        yield k
+
+def yielder_next():
+    f=iyielder(1)
+    a=next(f)
+    b=next(f)
+    return a, b, [i for i in f]"""
+        self.run_test(code, yielder_next=[])
+
     def test_yield_with_default_param(self):
         code="""
 def foo(a=1000):
@@ -269,6 +269,9 @@ class TestException(TestEnv):
     def test_no_msg_exception_register(self):
         self.run_test("def no_msg_exception_register():\n raise IndexError()", no_msg_exception_register=[], check_exception=True)
 
+    def test_key_check(self):
+        self.run_test("def key_check(n):\n d = {i: i * i for i in range(0, n, 3)}\n s = 0\n for i in range(n):\n  try:\n   s += d[i]\n  except KeyError:\n   s -= 1\n  try:\n   v = d[i]\n  except KeyError:\n   v = -i\n  s += v\n return s, len(d)", 20, key_check=[int])
+
 for exception in exceptions:
     # This one is not compatible with pytest
     if str(exception) in ("AssertionError", "UnicodeDecodeError",
@@ -117,6 +117,12 @@ def file_close(filename):
         self.tempfile()
         self.run_test("""def _iter(filename):\n f=open(filename)\n return [l for l in f]""", self.filename, _iter=[str])
 
+    def test_iter_long_lines(self):
+        self.filename = mkstemp()[1]
+        with open(self.filename, "w") as f:
+            f.write("a" * 100000 + "\n\n" + "b" * 70000)
+        self.run_test("""def _iter_long_lines(filename):\n f=open(filename)\n return [len(l) for l in f]""", self.filename, _iter_long_lines=[str])
+
     def test_fileno(self):
         self.tempfile()
         # Useless to check if same fileno, just checking if fct can be called
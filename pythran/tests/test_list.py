@@ -163,3 +163,18 @@ def init_array_empty_list(X,f):
         self.run_test(code,
                       0,
                       pop_while_iterating=[int])
+
+    def test_ragged_rows(self):
+        code = '''
+            def ragged_rows(adjacency, node):
+                total = len(adjacency[node]) + adjacency[-1][0]
+                for row in adjacency:
+                    total += sum(row) + len(row)
+                    for neighbour in row:
+                        if neighbour in adjacency[node]:
+                            total += neighbour
+                return total, sorted(adjacency[1]), max(adjacency[node])'''
+        self.run_test(code,
+                      [[3, 1, 2], [], [0, 4], [7, 2, 5, 1]],
+                      3,
+                      ragged_rows=[List[List[int]], int])
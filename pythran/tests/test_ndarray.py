@@ -845,6 +845,22 @@ def newaxis8(n):
             [1],
             numpy_indexing_ex14=[NDArray[int, :, :], List[int]])
 
+    def test_numpy_indexing_ex15(self):
+        self.run_test(
+            'def numpy_indexing_ex15(x, y, z): return (x[y] * z).sum(), x[y] + z',
+            numpy.arange(1000.),
+            (numpy.arange(3001) * 7919) % 1000,
+            numpy.arange(3001.),
+            numpy_indexing_ex15=[NDArray[float, :], NDArray[int, :], NDArray[float, :]])
+
+    def test_numpy_indexing_ex16(self):
+        self.run_test(
+            'def numpy_indexing_ex16(x, y, z): x[y] += z; x[y[::2]] = z[::2]; return x',
+            numpy.arange(1000.),
+            numpy.random.permutation(1000)[:777],
+            numpy.arange(777.),
+            numpy_indexing_ex16=[NDArray[float, :], NDArray[int, :], NDArray[float, :]])
+
     def test_numpy_expr_combiner(self):
         code = '''
             import numpy as np
@@ -958,6 +974,62 @@ def complex_conversion0(x):
                       1, numpy.array([1,2,3,4]),
                       numpy_lazy_gexpr2=[int, NDArray[int, :]])
 
+    def test_numpy_shared_expr(self):
+        code = '''
+            import numpy as np
+            def numpy_shared_expr(a, b):
+                x = np.sin(a)
+                y = a + b
+                z = np.cos(a)
+                return x * x + x, -y * y, np.sum(z * z - z)'''
+        self.run_test(code,
+                      numpy.arange(1000.), numpy.arange(1.),
+                      numpy_shared_expr=[NDArray[float, :],
+                                         NDArray[float, :]])
+
+    def test_numpy_shared_expr_slice(self):
+        code = '''
+            import numpy as np
+            def numpy_shared_expr_slice(a):
+                x = np.sin(a)
+                return (x * x + x)[1:], (x * x + x)[::2], (x * x - x)[-3:2:-5]'''
+        self.run_test(code, numpy.arange(100.),
+                      numpy_shared_expr_slice=[NDArray[float, :]])
+
+    def test_numpy_shared_expr_broadcast(self):
+        code = '''
+            import numpy as np
+            def numpy_shared_expr_broadcast(a, b):
+                x = np.sin(a)
+                return b * x + x'''
+        self.run_test(code, numpy.arange(600.),
+                      numpy.arange(6000.).reshape(10, 600),
+                      numpy_shared_expr_broadcast=[NDArray[float, :],
+                                                   NDArray[float, :, :]])
+
+    def test_numpy_fused_exprs(self):
+        code = '''
+            import numpy as np
+            def numpy_fused_exprs(a, b):
+                x = a * 2
+                y = x * x
+                z = b - 1
+                w = z * z
+                return y + y + x, np.sqrt(w + z)'''
+        self.run_test(code,
+                      numpy.arange(1000.), numpy.arange(10.),
+                      numpy_fused_exprs=[NDArray[float, :],
+                                         NDArray[float, :]])
+
+    def test_numpy_fused_exprs_slice(self):
+        code = '''
+            def numpy_fused_exprs_slice(a):
+                x = a * 2
+                y = x * x
+                return (y + y + x)[1:], (y - x)[::3]'''
+        self.run_test(code, numpy.arange(1000.),
+                      numpy_fused_exprs_slice=[NDArray[float, :]])
+
     def test_fexpr0(self):
         code = '''
             import numpy as np
@@ -1,5 +1,8 @@
 from pythran.tests import TestEnv
 from pythran.typing import List, Set, Dict, NDArray
+from pythran import compile_pythrancode, generate_cxx
+from pythran.config import cfg
+from textwrap import dedent
 import numpy as np
 
 class TestNoGil(TestEnv):
@@ -39,3 +42,68 @@ class TestNoGil(TestEnv):
                       ndarray_param=[NDArray[int, :]],
                       thread_count=4)
 
+    def test_scalar_param(self):
+        code="""
+        def scalar_param(n):
+            return sum(i * i for i in range(n))
+        """
+        self.run_test(code, 100, scalar_param=[int], thread_count=4)
+
+    def released_calls(self, keep_gil):
+        """
+        Number of exported functions whose wrapper releases the GIL, out of
+        a scalar-only one and a list-taking one.
+        """
+        code = """
+        def spin(n):
+            return sum(i * i for i in range(n))
+        def total(l):
+            return sum(l)
+        """
+        options = {'keep_gil_for_scalars': str(keep_gil),
+                   'batched_exports': 'False'}
+        saved = {key: cfg.get('pythran', key) for key in options}
+        for key, value in options.items():
+            cfg.set('pythran', key, value)
+        try:
+            module, _ = generate_cxx("released_calls", dedent(code),
+                                     {'spin': [int], 'total': [List[int]]})
+        finally:
+            for key, value in saved.items():
+                cfg.set('pythran', key, value)
+        return str(module).count('PyEval_SaveThread')
+
+    def test_scalar_param_releases_gil(self):
+        self.assertEqual(self.released_calls(keep_gil=False), 2)
+
+    def test_scalar_param_keeps_gil(self):
+        self.assertEqual(self.released_calls(keep_gil=True), 1)
+
+    def test_batched_scalar_params(self):
+        code = """
+        def batched_kernel(x, y):
+            return x * y + 1
+        """
+        module_path = compile_pythrancode(
+            "batched_kernel", dedent(code),
+            {'batched_kernel': [int, float]},
+            extra_compile_args=self.PYTHRAN_CXX_FLAGS)
+        runas = dedent("""
+            import numpy as np
+            # the two forms name their parameters differently
+            try:
+                batched_kernel_batched(x=[(1, .5), (2, .5)])
+                keywords = True
+            except TypeError:
+                keywords = False
+            {0} = (batched_kernel_batched(np.arange(5), np.ones(5)),
+                   batched_kernel_batched([1, 2], [.5, .5]),
+                   batched_kernel_batched([(1, .5), (2, .5)]),
+                   keywords)
+            """.format(self.TEST_RETURNVAL))
+        columns, lists, rows, keywords = self.run_pythran("batched_kernel",
+                                                          module_path, runas)
+        self.assertEqual(columns.tolist(), [1., 2., 3., 4., 5.])
+        self.assertEqual(lists.tolist(), [1.5, 2.])
+        self.assertEqual(rows.tolist(), [1.5, 2.])
+        self.assertFalse(keywords)
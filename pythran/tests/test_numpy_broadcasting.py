@@ -42,6 +42,23 @@ class TestBroadcasting(TestEnv):
                       [3] * 50,
                       broadcast_array3=[NDArray[int,:,:,:,:], List[int]])
 
+    def test_broadcast_flat0(self):
+        self.run_test('def broadcast_flat0(x, y): return 2 * x + y',
+                      np.arange(12000.).reshape(4000, 3),
+                      np.ones((4000, 3)),
+                      broadcast_flat0=[NDArray[float,:,:], NDArray[float,:,:]])
+
+    def test_broadcast_flat1(self):
+        self.run_test('def broadcast_flat1(x, y): x[1:] += y[1:] * 3; return x',
+                      np.arange(12000.).reshape(2, 6000),
+                      np.ones((2, 6000)),
+                      broadcast_flat1=[NDArray[float,:,:], NDArray[float,:,:]])
+
+    def test_broadcast_flat2(self):
+        self.run_test('def broadcast_flat2(x): x[:] = 3; return x',
+                      np.arange(12000).reshape(3, 1000, 4),
+                      broadcast_flat2=[NDArray[int,:,:,:]])
+
     def test_broadcast_with_ref(self):
         code = '''
             import numpy as np
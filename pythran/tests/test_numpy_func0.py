@@ -267,6 +267,36 @@ def np_rosen_der(x):
     def test_median6(self):
         self.run_test("def np_median6(l): from numpy import median ; return l + median(l)", numpy.array([3, 1]), np_median6=[NDArray[int, :]])
 
+    def test_median7(self):
+        self.run_test("def np_median7(a): from numpy import median ; return median(a, 1)", numpy.array([[1., 2., float('nan')], [4., 6., 5.]]), np_median7=[NDArray[float,:,:]])
+
+    def test_quantile0(self):
+        self.run_test("def np_quantile0(a): from numpy import quantile ; return quantile(a, 0.3), quantile(a, [0.9, 0.1, 0.5])", numpy.arange(100.) ** 2 % 17, np_quantile0=[NDArray[float,:]])
+
+    def test_quantile1(self):
+        self.run_test("def np_quantile1(a): from numpy import quantile ; return quantile(a, [0., 0.25, 1.], axis=0), quantile(a, 0.75, 1)", numpy.arange(60).reshape(3, 4, 5) ** 3 % 11, np_quantile1=[NDArray[int,:,:,:]])
+
+    def test_percentile0(self):
+        self.run_test("def np_percentile0(a): from numpy import percentile ; return percentile(a, 40), percentile(a, [10, 90], -1)", numpy.arange(30.).reshape(5, 6) ** 2 % 7, np_percentile0=[NDArray[float,:,:]])
+
+    def test_nanquantile0(self):
+        self.run_test("def np_nanquantile0(a): from numpy import nanquantile ; return nanquantile(a, 0.5), nanquantile(a, [0.2, 0.8], 0)", numpy.array([[1., numpy.nan, 3.], [4., 2., numpy.nan], [0., 5., 7.]]), np_nanquantile0=[NDArray[float,:,:]])
+
+    def test_nanpercentile0(self):
+        self.run_test("def np_nanpercentile0(a): from numpy import nanpercentile ; return nanpercentile(a, 35, axis=1)", numpy.array([[1., numpy.nan, 3.], [4., 2., numpy.nan], [0., 5., 7.]]), np_nanpercentile0=[NDArray[float,:,:]])
+
+    def test_partition0(self):
+        self.run_test("def np_partition0(a): from numpy import partition ; b = partition(a, 3); return b[:, 3], (b[:, :3].max(1) <= b[:, 3]).all(), (b[:, 4:].min(1) >= b[:, 3]).all()", numpy.arange(80).reshape(8, 10) * 37 % 23, np_partition0=[NDArray[int,:,:]])
+
+    def test_partition1(self):
+        self.run_test("def np_partition1(a): from numpy import partition, sort ; b = partition(a, [1, -2], axis=0); return b[1], b[-2], partition(a, 5, None)[5] == sort(a, None)[5]", numpy.arange(80.).reshape(10, 8) * 37 % 23, np_partition1=[NDArray[float,:,:]])
+
+    def test_argpartition0(self):
+        self.run_test("def np_argpartition0(a): from numpy import argpartition ; i = argpartition(a, 4); return a[i[4]], (a[i[:4]] <= a[i[4]]).all(), (a[i[5:]] >= a[i[4]]).all()", numpy.arange(35.) * 13 % 11 + numpy.arange(35.) / 100, np_argpartition0=[NDArray[float,:]])
+
+    def test_argpartition1(self):
+        self.run_test("def np_argpartition1(a): from numpy import argpartition ; i = argpartition(a, 1, axis=0); return i[1]", numpy.arange(35.).reshape(7, 5) * 13 % 11 + numpy.arange(35.).reshape(7, 5) / 100, np_argpartition1=[NDArray[float,:,:]])
+
     def test_mean0(self):
         self.run_test("def np_mean0(a): from numpy import mean ; return mean(a)", numpy.array([[1, 2], [3, 4]]), np_mean0=[NDArray[int,:,:]])
 
@@ -622,6 +652,12 @@ def np_rosen_der(x):
     def test_roll0(self):
         self.run_test("def np_roll0(x): from numpy import roll; return roll(x, 3)", numpy.arange(24).reshape(2,3,4), np_roll0=[NDArray[int, :, :, :]])
 
+    def test_searchsorted5(self):
+        self.run_test("def np_searchsorted5(x, y): from numpy import searchsorted, sort; return searchsorted(x, y), searchsorted(x, sort(y), 'right')", numpy.repeat(numpy.arange(5000.), 2), numpy.random.randn(20000) * 5000, np_searchsorted5=[NDArray[float,:], NDArray[float,:]])
+
+    def test_searchsorted4(self):
+        self.run_test("def np_searchsorted4(x, y): from numpy import searchsorted; return searchsorted(x, y), searchsorted(x, y, 'right')", numpy.arange(20), numpy.random.randint(-5, 25, (30, 40)), np_searchsorted4=[NDArray[int,:], NDArray[int,:,:]])
+
     def test_searchsorted3(self):
         self.run_test("def np_searchsorted3(x): from numpy import searchsorted; return searchsorted(x, [[3,4],[1,87]])", numpy.arange(6), np_searchsorted3=[NDArray[int,:]])
 
@@ -634,6 +670,9 @@ def np_rosen_der(x):
     def test_searchsorted0(self):
         self.run_test("def np_searchsorted0(x): from numpy import searchsorted; return searchsorted(x, 3, 'right')", numpy.arange(6), np_searchsorted0=[NDArray[int,:]])
 
+    def test_searchsorted6(self):
+        self.run_test("def np_searchsorted6(x, y): from numpy import searchsorted; return searchsorted(x, y.T + 1, 'right')", numpy.arange(0, 4000, 2), numpy.arange(3000).reshape(2, 1500), np_searchsorted6=[NDArray[int,:], NDArray[int,:,:]])
+
     def test_rot904(self):
         self.run_test("def np_rot904(x): from numpy import rot90; return rot90(x, 4)", numpy.arange(24).reshape(2,3,4), np_rot904=[NDArray[int, :, :, :]])
 
@@ -655,6 +694,9 @@ def np_rosen_der(x):
     def test_select1(self):
         self.run_test("def np_select1(x): from numpy import select; condlist = [x<3, x>5]; choicelist = [x+3, x**2]; return select(condlist, choicelist)", numpy.arange(10), np_select1=[NDArray[int,:]])
 
+    def test_select3(self):
+        self.run_test("def np_select3(x): from numpy import select; condlist = [x<-1.5, x>0, x<-3]; choicelist = [x+3, 2*x, x]; return select(condlist, choicelist, 9.)", numpy.linspace(-5, 5, 999).reshape(3, 333), np_select3=[NDArray[float,:,:]])
+
     def test_select0(self):
         self.run_test("def np_select0(x): from numpy import select; condlist = [x<3, x>5]; choicelist = [x, x**2]; return select(condlist, choicelist)", numpy.arange(10), np_select0=[NDArray[int,:]])
 
@@ -700,6 +742,18 @@ def np_rosen_der(x):
     def test_sort10(self):
         self.run_test("def np_sort10(a): from numpy import sort ; return sort(3*a, 0)", numpy.arange(2*3*4, 0, -1).reshape(2,3,4), np_sort10=[NDArray[int, :, :, :]])
 
+    def test_sort11(self):
+        self.run_test("""
+            def np_sort11(a):
+                from numpy import sort, array
+                b = a
+                c = sort(array(b), 0)
+                d = array(a.T)
+                d[0, 0] = 0
+                return a, b, c, d""",
+            numpy.arange(2*3, 0, -1).reshape(2,3),
+            np_sort11=[NDArray[int, :, :]])
+
     def test_sort_complex0(self):
         self.run_test("def np_sort_complex0(a): from numpy import sort_complex ; return sort_complex(a)", numpy.array([[1,6],[7,5]]), np_sort_complex0=[NDArray[int,:,:]])
 
@@ -748,6 +802,12 @@ def np_rosen_der(x):
     def test_tolist2(self):
         self.run_test("def np_tolist2(a): return a.tolist()", numpy.arange(2*3*4*5).reshape(2,3,4,5), np_tolist2=[NDArray[int, :, :, :, :]])
 
+    def test_tolist3(self):
+        self.run_test("def np_tolist3(a): return (a > 3).tolist()", numpy.arange(2*3*4).reshape(2,3,4), np_tolist3=[NDArray[int, :, :, :]])
+
+    def test_array_of_lists(self):
+        self.run_test("def np_array_of_lists(l): import numpy as np ; return np.array(l), len(l)", [[1., 2., 3.], [4., 5., 6.]], np_array_of_lists=[List[List[float]]])
+
     @unittest.skip("bytes/str confusion")
     def test_tostring0(self):
         self.run_test("def np_tostring0(a): return a.tostring()", numpy.arange(80, 100), np_tostring0=[NDArray[int,:]])
@@ -798,6 +858,9 @@ def np_rosen_der(x):
     def test_flatnonzero1(self):
         self.run_test("def np_flatnonzero1(x): from numpy import flatnonzero ;  return flatnonzero(x[1:-1])", numpy.arange(-2, 3), np_flatnonzero1=[NDArray[int,:]])
 
+    def test_flatnonzero2(self):
+        self.run_test("def np_flatnonzero2(x): from numpy import flatnonzero ; return flatnonzero(x % 37 == 0)", numpy.arange(60000).reshape(600, 100), np_flatnonzero2=[NDArray[int,:,:]])
+
     def test_fix0(self):
         self.run_test("def np_fix0(x): from numpy import fix ; return fix(x)", 3.14, np_fix0=[float])
 
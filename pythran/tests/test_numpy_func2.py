@@ -17,6 +17,12 @@ class TestNumpyFunc2(TestEnv):
     def test_nonzero2(self):
         self.run_test("def np_nonzero2(x): from numpy import nonzero ; return nonzero(x>0)", numpy.arange(6).reshape(2,3), np_nonzero2=[NDArray[int,:,:]])
 
+    def test_nonzero3(self):
+        self.run_test("def np_nonzero3(x): from numpy import nonzero ; return nonzero(x % 37 == 0)", numpy.arange(60000).reshape(30, 20, 100), np_nonzero3=[NDArray[int,:,:,:]])
+
+    def test_nonzero4(self):
+        self.run_test("def np_nonzero4(x): return x[x % 37 == 0], x[(x % 37 == 0).astype(bool)]", numpy.arange(60000.), np_nonzero4=[NDArray[float,:]])
+
     def test_diagflat3(self):
         self.run_test("def np_diagflat3(a): from numpy import diagflat ; return diagflat(a)", numpy.arange(2), np_diagflat3=[NDArray[int,:]])
 
@@ -109,6 +115,16 @@ class TestNumpyFunc2(TestEnv):
     from numpy import arange, where
     return where(a>5)""", numpy.arange(12).reshape(3,4), np_where7=[NDArray[int,:,:]])
 
+    def test_where8(self):
+        self.run_test("""def np_where8(a):
+    from numpy import where
+    return where(a > 0, a, 0.1 * a)""", numpy.linspace(-5, 5, 1001), np_where8=[NDArray[float,:]])
+
+    def test_where9(self):
+        self.run_test("""def np_where9(a, b):
+    from numpy import where
+    return where((a > b) & (b > 0.5), a - b, b)""", numpy.linspace(-5, 5, 1001).reshape(7, 143), numpy.linspace(0, 1, 143), np_where9=[NDArray[float,:,:], NDArray[float,:]])
+
     def test_cumprod_(self):
         self.run_test("def np_cumprod_(a):\n return a.cumprod()", numpy.arange(10), np_cumprod_=[NDArray[int,:]])
 
@@ -192,6 +208,18 @@ class TestNumpyFunc2(TestEnv):
                   numpy.arange(7,dtype=float),
                   np_correlate_11=[NDArray[numpy.float32,:],NDArray[float,:]])
 
+    def test_correlate_12(self):
+        self.run_test("def np_correlate_12(a,b):\n from numpy import correlate\n return correlate(a,b,'same')",
+                  numpy.cos(numpy.arange(5000.)),
+                  numpy.sin(numpy.arange(300.)),
+                  np_correlate_12=[NDArray[float,:],NDArray[float,:]])
+
+    def test_correlate_13(self):
+        self.run_test("def np_correlate_13(a,b):\n from numpy import correlate\n return correlate(a,b,'full')",
+                  numpy.arange(100) % 7,
+                  numpy.arange(1000) % 11,
+                  np_correlate_13=[NDArray[int,:],NDArray[int,:]])
+
     def test_convolve_1(self):
         self.run_test("def np_convolve_1(a,b):\n from numpy import convolve\n return convolve(a,b)",
                       numpy.arange(10,dtype=float),
@@ -259,6 +287,18 @@ class TestNumpyFunc2(TestEnv):
                   numpy.arange(12,dtype=numpy.float32),
                   numpy.arange(7,dtype=float),
                   np_convolve_11=[NDArray[numpy.float32,:],NDArray[float,:]])
+
+    def test_convolve_12(self):
+        self.run_test("def np_convolve_12(a,b):\n from numpy import convolve\n return convolve(a,b,'full')",
+                  numpy.arange(200.) + 1j * numpy.cos(numpy.arange(200.)),
+                  numpy.sin(numpy.arange(3000.)) - 1j,
+                  np_convolve_12=[NDArray[complex,:],NDArray[complex,:]])
+
+    def test_convolve_13(self):
+        self.run_test("def np_convolve_13(a,b):\n from numpy import convolve\n return convolve(a,b,'valid')",
+                  numpy.linspace(-1, 1, 4000, dtype=numpy.float32),
+                  numpy.linspace(0, 1, 150, dtype=numpy.float32),
+                  np_convolve_13=[NDArray[numpy.float32,:],NDArray[numpy.float32,:]])
         
     def test_copy0(self):
         code= '''
@@ -300,6 +340,9 @@ def test_copy0(x):
     def test_clip1(self):
         self.run_test("def np_clip1(a): from numpy import  clip ; return clip(a,3,6)", numpy.arange(10), np_clip1=[NDArray[int,:]])
 
+    def test_clip2(self):
+        self.run_test("def np_clip2(a, b): from numpy import clip ; return clip(a, -b, b)", numpy.linspace(-5, 5, 1001), numpy.linspace(0, 2, 1001), np_clip2=[NDArray[float,:], NDArray[float,:]])
+
     def test_concatenate0(self):
         self.run_test("def np_concatenate0(a): from numpy import array, concatenate ; b = array([[5, 6]]) ; return concatenate((a,b))", numpy.array([[1, 2], [3, 4]]), np_concatenate0=[NDArray[int,:,:]])
 
@@ -385,6 +428,30 @@ def test_copy0(x):
     def test_bincount2(self):
         self.run_test("def np_bincount2(a, w): from numpy import bincount; return bincount(a + 1,w)", numpy.array([0, 1, 1, 2, 2, 2]), numpy.array([0.3, 0.5, 0.2, 0.7, 1., -0.6]), np_bincount2=[NDArray[int,:], NDArray[float,:]])
 
+    def test_bincount3(self):
+        self.run_test("def np_bincount3(a): from numpy import bincount; return bincount(a % 7, minlength=10)", numpy.arange(100000), np_bincount3=[NDArray[int,:]])
+
+    def test_bincount4(self):
+        self.run_test("def np_bincount4(a): from numpy import bincount; return bincount((a * 2.5).astype(int))", numpy.arange(5000.) % 13, np_bincount4=[NDArray[float,:]])
+
+    def test_histogram0(self):
+        self.run_test("def np_histogram0(a): from numpy import histogram; return histogram(a)", numpy.array([1., 2., 1., .5, 3., 2.5, 0., 3.]), np_histogram0=[NDArray[float,:]])
+
+    def test_histogram1(self):
+        self.run_test("def np_histogram1(a, b): from numpy import histogram; return histogram(a, b)", numpy.arange(20.) % 7, numpy.array([0., 1., 2.5, 6.]), np_histogram1=[NDArray[float,:], NDArray[float,:]])
+
+    def test_histogram2(self):
+        self.run_test("def np_histogram2(a): from numpy import histogram; return histogram(a, 5, (1, 4), True)", numpy.arange(30.).reshape(5, 6) % 5, np_histogram2=[NDArray[float,:,:]])
+
+    def test_histogram3(self):
+        self.run_test("def np_histogram3(a, w): from numpy import histogram; return histogram(a, 3, weights=w)", numpy.arange(10), numpy.arange(10.) / 3, np_histogram3=[NDArray[int,:], NDArray[float,:]])
+
+    def test_histogram2d0(self):
+        self.run_test("def np_histogram2d0(x, y): from numpy import histogram2d; return histogram2d(x, y, (3, 4))", numpy.arange(50.) % 7, numpy.arange(50.) % 5, np_histogram2d0=[NDArray[float,:], NDArray[float,:]])
+
+    def test_histogramdd0(self):
+        self.run_test("def np_histogramdd0(x, y, z): from numpy import histogramdd; h, e = histogramdd((x, y, z), 2, density=True); return h, e[2]", numpy.arange(50.) % 7, numpy.arange(50.) % 5, numpy.arange(50.) % 3, np_histogramdd0=[NDArray[float,:], NDArray[float,:], NDArray[float,:]])
+
     def test_binary_repr0(self):
         self.run_test("def np_binary_repr0(a): from numpy import binary_repr ; return binary_repr(a)", 3, np_binary_repr0=[int])
 
@@ -562,6 +629,9 @@ def test_copy0(x):
     def test_argwhere2(self):
         self.run_test("def np_argwhere2(x): from numpy import argwhere ; return argwhere(x>0)", numpy.arange(6).reshape(2,3), np_argwhere2=[NDArray[int,:,:]])
 
+    def test_argwhere3(self):
+        self.run_test("def np_argwhere3(x): from numpy import argwhere ; return argwhere(x % 37 == 0)", numpy.arange(60000).reshape(600, 100), np_argwhere3=[NDArray[int,:,:]])
+
     def test_around0(self):
         self.run_test("def np_around0(x): from numpy import around ; return around(x)", [0.37, 1.64], np_around0=[List[float]])
 
@@ -1009,6 +1079,12 @@ def np_broadcast_dup():
     def test_cumsum5_(self):
         self.run_test("def np_cumsum5_(a): return a.cumsum(0)", numpy.arange(10), np_cumsum5_=[NDArray[int,:]])
 
+    def test_cumsum6_(self):
+        self.run_test("def np_cumsum6_(a): return a.cumsum(), a.T.cumsum(), a.cumsum(1)", numpy.arange(300000).reshape(3, 400, 250) % 17, np_cumsum6_=[NDArray[int,:,:,:]])
+
+    def test_cumsum7_(self):
+        self.run_test("def np_cumsum7_(a): return (a * 2).cumsum(0)", numpy.arange(300000.).reshape(1200, 250) % 13, np_cumsum7_=[NDArray[float,:,:]])
+
     def test_sum_(self):
         self.run_test("def np_sum_(a): return a.sum()", numpy.arange(10), np_sum_=[NDArray[int,:]])
 
@@ -1048,3 +1124,108 @@ def np_broadcast_dup():
             np_matrix_power2=[NDArray[float,:,:]]
         )
 
+    def test_matrix_power3(self):
+        self.run_test(
+            "def np_matrix_power3(a): from numpy.linalg import matrix_power; return matrix_power(a + a.T, 11), matrix_power(numpy.triu(a), 6), matrix_power(numpy.tril(a), 7)",
+            numpy.arange(64.).reshape(8,8) / 64,
+            np_matrix_power3=[NDArray[float,:,:]]
+        )
+
+    def test_matrix_power4(self):
+        self.run_test(
+            "def np_matrix_power4(a): from numpy.linalg import matrix_power; return matrix_power(a, 9)",
+            numpy.arange(16).reshape(4,4) % 3 - 1,
+            np_matrix_power4=[NDArray[int,:,:]]
+        )
+
+    def test_dot_out0(self):
+        self.run_test(
+            "def np_dot_out0(a, b): import numpy as np; c = np.empty((a.shape[0], b.shape[1])); d = np.dot(a, b, out=c); return c, d",
+            numpy.arange(12.).reshape(3,4),
+            numpy.arange(20.).reshape(4,5),
+            np_dot_out0=[NDArray[float,:,:], NDArray[float,:,:]]
+        )
+
+    def test_dot_out1(self):
+        self.run_test(
+            "def np_dot_out1(a, b): import numpy as np; c = np.ones(a.shape[0], dtype=int); a.dot(b, out=c); return c",
+            numpy.arange(12).reshape(3,4),
+            numpy.arange(4),
+            np_dot_out1=[NDArray[int,:,:], NDArray[int,:]]
+        )
+
+    def test_dot_accumulate0(self):
+        self.run_test(
+            "def np_dot_accumulate0(a, b): import numpy as np; c = np.ones((a.shape[0], b.shape[1])); c += np.dot(a, b); a += np.dot(a, a.T); return a, c",
+            numpy.arange(12.).reshape(3,4) / 12,
+            numpy.arange(20.).reshape(4,5) / 20,
+            np_dot_accumulate0=[NDArray[float,:,:], NDArray[float,:,:]]
+        )
+
+
+    def test_det0(self):
+        self.run_test(
+            "def np_det0(a): from numpy.linalg import det; return det(a), det(a[1:, 1:])",
+            numpy.array([[2., 1., 0.], [1., 3., 1.], [0., 1., 4.]]),
+            np_det0=[NDArray[float,:,:]]
+        )
+
+    def test_det1(self):
+        self.run_test(
+            "def np_det1(a): from numpy.linalg import det; return det(a)",
+            numpy.arange(36.).reshape(4, 3, 3) ** 2 % 7,
+            np_det1=[NDArray[float,:,:,:]]
+        )
+
+    def test_inv0(self):
+        self.run_test(
+            "def np_inv0(a): from numpy.linalg import inv; return inv(a)",
+            numpy.arange(100.).reshape(10, 10) ** 2 % 17,
+            np_inv0=[NDArray[float,:,:]]
+        )
+
+    def test_inv1(self):
+        self.run_test(
+            "def np_inv1(a): from numpy.linalg import inv; return inv(a)",
+            numpy.arange(36).reshape(4, 3, 3) ** 2 % 7,
+            np_inv1=[NDArray[int,:,:,:]]
+        )
+
+    def test_solve0(self):
+        self.run_test(
+            "def np_solve0(a, b): from numpy.linalg import solve; return solve(a, b), solve(a, b[:, 0])",
+            numpy.arange(100.).reshape(10, 10) ** 2 % 17,
+            numpy.arange(30.).reshape(10, 3),
+            np_solve0=[NDArray[float,:,:], NDArray[float,:,:]]
+        )
+
+    def test_solve1(self):
+        self.run_test(
+            "def np_solve1(a, b): from numpy.linalg import solve; return solve(a, b)",
+            numpy.arange(36.).reshape(4, 3, 3) ** 2 % 7 + numpy.eye(3),
+            numpy.arange(24.).reshape(4, 3, 2),
+            np_solve1=[NDArray[float,:,:,:], NDArray[float,:,:,:]]
+        )
+
+    def test_cholesky0(self):
+        self.run_test(
+            "def np_cholesky0(a): from numpy.linalg import cholesky; from numpy import dot, eye; return cholesky(dot(a, a.T) + 10 * eye(a.shape[0]))",
+            numpy.arange(100.).reshape(10, 10) ** 2 % 17,
+            np_cholesky0=[NDArray[float,:,:]]
+        )
+
+    def test_lstsq0(self):
+        self.run_test(
+            "def np_lstsq0(a, b): from numpy.linalg import lstsq; return lstsq(a, b, rcond=None)",
+            numpy.array([[0., 1.], [1., 1.], [2., 1.], [3., 1.]]),
+            numpy.array([-1., 0.2, 0.9, 2.1]),
+            np_lstsq0=[NDArray[float,:,:], NDArray[float,:]]
+        )
+
+    def test_lstsq1(self):
+        self.run_test(
+            "def np_lstsq1(a, b): from numpy.linalg import lstsq; x, r, k, s = lstsq(a, b, None); return x, k, s",
+            numpy.arange(15.).reshape(3, 5) ** 2 % 7,
+            numpy.arange(6.).reshape(3, 2),
+            np_lstsq1=[NDArray[float,:,:], NDArray[float,:,:]]
+        )
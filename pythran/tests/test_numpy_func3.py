@@ -220,12 +220,58 @@ class TestNumpyFunc3(TestEnv):
 
 
 
+    def test_einsum0(self):
+        self.run_test("def np_einsum0(x, y): from numpy import einsum; return einsum('ij,jk->ik', x, y)",
+                      numpy.arange(12.).reshape(3, 4),
+                      numpy.arange(20.).reshape(4, 5),
+                      np_einsum0=[NDArray[float,:,:], NDArray[float,:,:]])
+
+    def test_einsum1(self):
+        self.run_test("def np_einsum1(x, y): from numpy import einsum; return einsum('bij,bkj->bik', x, y), einsum('ii', x[0,:,:3]), einsum('ij->j', y[1])",
+                      numpy.arange(24.).reshape(2, 3, 4),
+                      numpy.arange(40.).reshape(2, 5, 4),
+                      np_einsum1=[NDArray[float,:,:,:], NDArray[float,:,:,:]])
+
+    def test_einsum2(self):
+        self.run_test("def np_einsum2(x, y, z): from numpy import einsum; return einsum('ij,jk,k', x, y, z)",
+                      numpy.arange(12).reshape(3, 4),
+                      numpy.arange(20.).reshape(4, 5),
+                      numpy.arange(5.),
+                      np_einsum2=[NDArray[int,:,:], NDArray[float,:,:], NDArray[float,:]])
+
+    def test_tensordot0(self):
+        self.run_test("def np_tensordot0(x, y): from numpy import tensordot; return tensordot(x, y), tensordot(x, y, axes=1).shape",
+                      numpy.arange(60.).reshape(3, 4, 5),
+                      numpy.arange(40.).reshape(4, 5, 2),
+                      np_tensordot0=[NDArray[float,:,:,:], NDArray[float,:,:,:]])
+
+    def test_tensordot1(self):
+        self.run_test("def np_tensordot1(x, y): from numpy import tensordot; return tensordot(x, y, ((0, 2), (1, 0)))",
+                      numpy.arange(60.).reshape(3, 4, 5),
+                      numpy.arange(30.).reshape(5, 3, 2),
+                      np_tensordot1=[NDArray[float,:,:,:], NDArray[float,:,:,:]])
+
+    def test_matmul0(self):
+        self.run_test("def np_matmul0(x, y): from numpy import matmul; return matmul(x, y), x @ y[0]",
+                      numpy.arange(24.).reshape(2, 3, 4),
+                      numpy.arange(40.).reshape(2, 4, 5),
+                      np_matmul0=[NDArray[float,:,:,:], NDArray[float,:,:,:]])
+
+    def test_matmul1(self):
+        self.run_test("def np_matmul1(x, y): from numpy import matmul; return matmul(x, y)",
+                      numpy.arange(24).reshape(2, 1, 3, 4),
+                      numpy.arange(40).reshape(5, 4, 2),
+                      np_matmul1=[NDArray[int,:,:,:,:], NDArray[int,:,:,:]])
+
     def test_digitize0(self):
         self.run_test("def np_digitize0(x): from numpy import array, digitize ; bins = array([0.0, 1.0, 2.5, 4.0, 10.0]) ; return digitize(x, bins)", numpy.array([0.2, 6.4, 3.0, 1.6]), np_digitize0=[NDArray[float,:]])
 
     def test_digitize1(self):
         self.run_test("def np_digitize1(x): from numpy import array, digitize ; bins = array([ 10.0, 4.0, 2.5, 1.0, 0.0]) ; return digitize(x, bins)", numpy.array([0.2, 6.4, 3.0, 1.6]), np_digitize1=[NDArray[float,:]])
 
+    def test_digitize2(self):
+        self.run_test("def np_digitize2(x): from numpy import array, digitize ; bins = array([0.0, 1.0, 2.5, 4.0, 10.0]) ; return digitize(x, bins), digitize(x, bins[::-1])", numpy.array([0.2, 6.4, 3.0, 1.6, 1.0, 10.0, 11.]), np_digitize2=[NDArray[float,:]])
+
     def test_diff0(self):
         self.run_test("def np_diff0(x): from numpy import diff; return diff(x)", numpy.array([1, 2, 4, 7, 0]), np_diff0=[NDArray[int,:]])
 
@@ -553,6 +599,43 @@ def np_trim_zeros2(x):
                       10.,
                       interp5=[NDArray[float,:],float])
 
+    def test_interp_6(self):
+        self.run_test('def interp6(x,xp,fp): import numpy as np; return np.interp(x,xp,fp)',
+                      numpy.concatenate([numpy.random.randn(5000), numpy.sort(numpy.random.randn(5000))]),
+                      numpy.sort(numpy.random.randn(10)),
+                      numpy.random.randn(10),
+                      interp6=[NDArray[float,:],NDArray[float,:],NDArray[float,:]])
+
+    def test_interp_7(self):
+        self.run_test('def interp7(x,xp,fp): import numpy as np; return np.interp(x,xp,fp,period=-360)',
+                      numpy.arange(-400, 800, 3),
+                      numpy.array([190., -190., 350., -350., 0.]),
+                      numpy.array([5., 10., 3., 4., 1.]),
+                      interp7=[NDArray[int,:],NDArray[float,:],NDArray[float,:]])
+
+    def test_interp_8(self):
+        self.run_test('def interp8(x,xp,fp): import numpy as np; return np.interp(x,xp,fp,0.,1.)',
+                      numpy.linspace(-1, 11, 5000),
+                      numpy.array([0., 1., 1., 2., 5., 10.]),
+                      numpy.array([0., 1., 3., 3., 0., 2.]),
+                      interp8=[NDArray[float,:],NDArray[float,:],NDArray[float,:]])
+
+    def test_interp_empty_xp(self):
+        self.run_test('def interp_empty_xp(x,xp,fp): import numpy as np; return np.interp(x,xp,fp)',
+                      numpy.linspace(-1, 11, 50),
+                      numpy.array([], dtype=float),
+                      numpy.array([], dtype=float),
+                      interp_empty_xp=[NDArray[float,:],NDArray[float,:],NDArray[float,:]],
+                      check_exception=True)
+
+    def test_interp_length_mismatch(self):
+        self.run_test('def interp_length_mismatch(x,xp,fp): import numpy as np; return np.interp(x,xp,fp)',
+                      numpy.linspace(-1, 11, 50),
+                      numpy.array([0., 1., 2., 5.]),
+                      numpy.array([0., 1., 3.]),
+                      interp_length_mismatch=[NDArray[float,:],NDArray[float,:],NDArray[float,:]],
+                      check_exception=True)
+
     def test_setdiff1d0(self):
         self.run_test('def setdiff1d0(x,y): import numpy as np; return np.setdiff1d(x,y)',
                       numpy.random.randn(100),
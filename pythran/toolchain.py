@@ -3,6 +3,7 @@ This module contains all the stuff to make your way from python code to
 a dynamic library, see __init__.py for exported interfaces.
 '''
 
+from pythran.analyses import RaggedArguments
 from pythran.backend import Cxx, Python
 from pythran.config import cfg
 from pythran.cxxgen import PythonModule, Include, Line, Statement
@@ -14,7 +15,9 @@ from pythran.passmanager import PassManager
 from pythran.tables import pythran_ward
 from pythran.types import tog
 from pythran.types.type_dependencies import pytype_to_deps
-from pythran.types.conversion import pytype_to_ctype
+from pythran.types.conversion import pytype_to_ctype, PYTYPE_TO_CTYPE_TABLE
+from pythran.types.conversion import pytype_to_ragged_ctype
+from pythran.typing import List, Tuple
 from pythran.spec import load_specfile, Spec
 from pythran.spec import spec_to_string
 from pythran.syntax import check_specs, check_exports, PythranSyntaxError
@@ -59,6 +62,37 @@ def _extract_specs_dependencies(specs):
     return sorted(deps, key=lambda x: "include" not in x)
 
 
+def _is_scalar_signature(signature):
+    """ True if all the arguments of `signature' are numerical scalars. """
+    return all(t in PYTYPE_TO_CTYPE_TABLE and t not in (str, slice, type(None))
+               for t in signature)
+
+
+def _arguments_types(signature, ragged):
+    """
+    C++ type of each argument of `signature', converted to a ragged list of
+    lists when its index is in `ragged' and its type allows it.
+    """
+    arguments_types = []
+    for i, t in enumerate(signature):
+        ctype = pytype_to_ragged_ctype(t) if i in ragged else None
+        arguments_types.append(ctype or pytype_to_ctype(t))
+    return arguments_types
+
+
+def _batched_signatures(specs):
+    """ Yield the name and the signature of each batched entry point. """
+    if not cfg.getboolean('pythran', 'batched_exports'):
+        return
+    for function_name, signatures in specs.functions.items():
+        batched_name = function_name + '_batched'
+        if batched_name in specs.functions:
+            continue
+        for sigid, signature in enumerate(signatures):
+            if signature and _is_scalar_signature(signature):
+                yield function_name, batched_name, sigid, signature
+
+
 def _parse_optimization(optimization):
     '''Turns an optimization of the form
         my_optim
@@ -141,6 +175,7 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
 
     # back-end
     content = pm.dump(Cxx, ir)
+    ragged_arguments = pm.gather(RaggedArguments, ir)
 
     # instantiate the meta program
     if specs is None:
@@ -191,6 +226,11 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
         )
         mod.add_to_includes(*[Include(inc) for inc in
                               _extract_specs_dependencies(specs)])
+        if any(_batched_signatures(specs)):
+            mod.add_to_includes(Include("pythonic/python/batch.hpp"))
+        if any(ragged_arguments.get(function_name)
+               for function_name in specs.functions):
+            mod.add_to_includes(Include("pythonic/types/ragged.hpp"))
         mod.add_to_includes(*content.body)
         mod.add_to_includes(
             Include("pythonic/python/exception_handler.hpp"),
@@ -199,6 +239,21 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
         def warded(module_name, internal_name):
             return pythran_ward + '{0}::{1}'.format(module_name, internal_name)
 
+        gil_released_call = """
+            PyThreadState *_save = PyEval_SaveThread();
+            try {{
+                auto res = {0}({1});
+                PyEval_RestoreThread(_save);
+                return res;
+            }}
+            catch(...) {{
+                PyEval_RestoreThread(_save);
+                throw;
+            }}
+            """
+        keep_gil_for_scalars = cfg.getboolean('pythran',
+                                              'keep_gil_for_scalars')
+
         for function_name, signatures in specs.functions.items():
             internal_func_name = cxxid(function_name)
             # global variables are functions with no signatures :-)
@@ -210,7 +265,8 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
             for sigid, signature in enumerate(signatures):
                 numbered_function_name = "{0}{1}".format(internal_func_name,
                                                          sigid)
-                arguments_types = [pytype_to_ctype(t) for t in signature]
+                arguments_types = _arguments_types(
+                    signature, ragged_arguments.get(function_name, ()))
                 arguments_names = has_argument(ir, function_name)
                 arguments = [n for n, _ in
                              zip(arguments_names, arguments_types)]
@@ -221,6 +277,15 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
                                                     "<{0}>".format(args_list)
                                                     if arguments_names else "")
                 result_type = "typename %s::result_type" % specialized_fname
+                if keep_gil_for_scalars and _is_scalar_signature(signature):
+                    # save the cost of releasing the GIL, on request
+                    body = ReturnStatement("{0}()({1})".format(
+                        warded(module_name, internal_func_name),
+                        ', '.join(arguments)))
+                else:
+                    body = Statement(gil_released_call.format(
+                        warded(module_name, internal_func_name) + '()',
+                        ', '.join(arguments)))
                 mod.add_pyfunction(
                     FunctionBody(
                         FunctionDeclaration(
@@ -229,26 +294,70 @@ def generate_cxx(module_name, code, specs=None, optimizations=None,
                                 numbered_function_name),
                             [Value(t + '&&', a)
                              for t, a in zip(arguments_types, arguments)]),
-                        Block([Statement("""
-                            PyThreadState *_save = PyEval_SaveThread();
-                            try {{
-                                auto res = {0}()({1});
-                                PyEval_RestoreThread(_save);
-                                return res;
-                            }}
-                            catch(...) {{
-                                PyEval_RestoreThread(_save);
-                                throw;
-                            }}
-                            """.format(warded(module_name,
-                                              internal_func_name),
-                                       ', '.join(arguments)))])
+                        Block([body])
                     ),
                     function_name,
                     arguments_types,
                     signature
                 )
 
+        for (function_name, batched_name, sigid,
+             signature) in _batched_signatures(specs):
+            internal_func_name = cxxid(function_name)
+            arguments_types = [pytype_to_ctype(t) for t in signature]
+            arguments = has_argument(ir, function_name)[:len(signature)]
+            name_fmt = pythran_ward + "{0}::{1}::type<{2}>"
+            specialized_fname = name_fmt.format(module_name,
+                                                internal_func_name,
+                                                ", ".join(arguments_types))
+            result_type = ("typename pythonic::python::batch_result<"
+                           "typename {}::result_type>::type"
+                           .format(specialized_fname))
+
+            # one sequence per argument
+            columns_types = ['pythonic::python::batch_column<{}>'.format(t)
+                             for t in arguments_types]
+            mod.add_pyfunction(
+                FunctionBody(
+                    FunctionDeclaration(
+                        Value(result_type,
+                              "{0}_batched{1}".format(internal_func_name,
+                                                      sigid)),
+                        [Value(t + '&&', a)
+                         for t, a in zip(columns_types, arguments)]),
+                    Block([Statement(gil_released_call.format(
+                        'pythonic::python::batch_call',
+                        ', '.join([warded(module_name,
+                                          internal_func_name) + '()'] +
+                                  arguments)))])
+                ),
+                batched_name,
+                columns_types,
+                tuple(List[t] for t in signature)
+            )
+
+            # one sequence of argument tuples
+            if len(signature) < 2:
+                continue
+            rows_signature = List[Tuple[tuple(signature)]]
+            rows_type = pytype_to_ctype(rows_signature)
+            mod.add_pyfunction(
+                FunctionBody(
+                    FunctionDeclaration(
+                        Value(result_type,
+                              "{0}_batched_rows{1}".format(internal_func_name,
+                                                           sigid)),
+                        [Value(rows_type + '&&', 'rows')]),
+                    Block([Statement(gil_released_call.format(
+                        'pythonic::python::batch_call_rows',
+                        '{}(), rows'.format(warded(module_name,
+                                                   internal_func_name))))])
+                ),
+                batched_name,
+                [rows_type],
+                (rows_signature,)
+            )
+
         for function_name, signature in specs.capsules.items():
             internal_func_name = cxxid(function_name)
 
@@ -19,6 +19,7 @@ from .extract_doc_strings import ExtractDocStrings
 from .false_polymorphism import FalsePolymorphism
 from .handle_import import HandleImport
 from .normalize_compare import NormalizeCompare
+from .normalize_einsum import NormalizeEinsum
 from .normalize_exception import NormalizeException
 from .normalize_ifelse import NormalizeIfElse
 from .normalize_is_none import NormalizeIsNone
@@ -0,0 +1,56 @@
+""" NormalizeEinsum passes the rank of einsum results to einsum calls. """
+
+from pythran.analyses import Aliases
+from pythran.passmanager import Transformation
+from pythran.syntax import PythranSyntaxError
+from pythran.tables import MODULES
+from pythran.utils import isstr
+
+import gast as ast
+
+
+def einsum_rank(subscripts):
+    ''' Number of labels in the result of an einsum. '''
+    if '.' in subscripts:
+        raise ValueError("ellipsis is not supported")
+    if '->' in subscripts:
+        return sum(1 for c in subscripts.split('->')[1] if c.isalpha())
+    inputs = subscripts.replace(',', '')
+    return sum(1 for c in set(inputs) if c.isalpha() and inputs.count(c) == 1)
+
+
+class NormalizeEinsum(Transformation):
+    '''
+    Prepends the rank of the result to numpy.einsum calls, so that it is
+    known at compile time.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager, backend
+    >>> node = ast.parse("def foo(a, b): "
+    ...                  "return __pythran_import_numpy.einsum('ij,jk', a, b)")
+    >>> pm = passmanager.PassManager("test")
+    >>> _, node = pm.apply(NormalizeEinsum, node)
+    >>> print(pm.dump(backend.Python, node))
+    def foo(a, b):
+        return __pythran_import_numpy.einsum(2, 'ij,jk', a, b)
+    '''
+
+    def __init__(self):
+        super(NormalizeEinsum, self).__init__(Aliases)
+
+    def visit_Call(self, node):
+        self.generic_visit(node)
+        if MODULES['numpy']['einsum'] not in self.aliases[node.func]:
+            return node
+        if len(node.args) > 1 and isstr(node.args[1]):  # already normalized
+            return node
+        if not node.args or not isstr(node.args[0]):
+            raise PythranSyntaxError("numpy.einsum requires literal "
+                                     "subscripts", node)
+        try:
+            rank = einsum_rank(node.args[0].value)
+        except ValueError as ve:
+            raise PythranSyntaxError("numpy.einsum: {}".format(ve), node)
+        node.args.insert(0, ast.Constant(rank, None))
+        self.update = True
+        return node
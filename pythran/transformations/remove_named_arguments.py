@@ -65,6 +65,14 @@ class RemoveNamedArguments(Transformation):
                                       kw.value))
                 node.keywords.pop(nb_kw - i - 1)
 
+        # when they all have a default value, keyword-only arguments are
+        # passed as a whole, so that they can be told apart by position
+        kw_defaults = func.args.kw_defaults
+        if keywords_only and kw_defaults and all(kw_defaults):
+            given = dict(keywords_only)
+            keywords_only = [(i, given.get(i, deepcopy(default)))
+                             for i, default in enumerate(kw_defaults)]
+
         keywords_only = [v for _, v in sorted(keywords_only)]
 
         extra_keyword_offset = max(keywords.keys()) if keywords else 0
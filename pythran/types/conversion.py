@@ -99,6 +99,20 @@ def pytype_to_ctype(t):
         raise NotImplementedError("{0}:{1}".format(type(t), t))
 
 
+def pytype_to_ragged_ctype(t):
+    """
+    Python -> pythonic ragged list binding, for a list of lists of scalars.
+
+    Returns None for any other type.
+    """
+    if not isinstance(t, List) or not isinstance(t.__args__[0], List):
+        return None
+    dtype = t.__args__[0].__args__[0]
+    if dtype not in PYTYPE_TO_CTYPE_TABLE or dtype in (str, slice, type(None)):
+        return None
+    return 'pythonic::types::ragged<{0}>'.format(PYTYPE_TO_CTYPE_TABLE[dtype])
+
+
 def pytype_to_pretty_type(t):
     """ Python -> docstring type. """
     if isinstance(t, List):
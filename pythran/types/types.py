@@ -5,6 +5,7 @@ This module performs the return type inference, according to symbolic types,
 '''
 
 from pythran.analyses import LazynessAnalysis, StrictAliases, YieldPoints
+from pythran.analyses import SharedOperands
 from pythran.analyses import LocalNodeDeclarations, Immediates, RangeValues
 from pythran.config import cfg
 from pythran.cxxtypes import TypeBuilder, ordered_set
@@ -50,7 +51,7 @@ class Types(ModuleAnalysis):
         self.current_global_declarations = dict()
         self.max_recompute = 1  # max number of use to be lazy
         ModuleAnalysis.__init__(self, Reorder, StrictAliases, LazynessAnalysis,
-                                Immediates, RangeValues)
+                                SharedOperands, Immediates, RangeValues)
         self.curr_locals_declaration = None
 
     def prepare(self, node):
@@ -275,9 +276,13 @@ class Types(ModuleAnalysis):
 
     def get_qualifier(self, node):
         lazy_res = self.lazyness_analysis[node.id]
-        return (self.builder.Lazy
-                if lazy_res <= self.max_recompute
-                else self.builder.Assignable)
+        if lazy_res <= self.max_recompute:
+            return self.builder.Lazy
+        # read several times, but by a single statement
+        if (node.id in self.shared_operands and
+                lazy_res < LazynessAnalysis.MANY):
+            return self.builder.Shared
+        return self.builder.Assignable
 
     def visit_Return(self, node):
         """ Compute return type and merges with others possible return type."""